@@ -0,0 +1,186 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Benchmark result regression comparison tool.
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace {
+//! @brief The key of a recorded benchmark result: its title, name, and size.
+using key = std::tuple<std::string, std::string, std::string>;
+
+//! @brief The measurements of a recorded benchmark result.
+struct measurement {
+  //! @brief Median elapsed time in seconds.
+  double elapsed{0.};
+
+  //! @brief Median absolute percent error of the elapsed time, as a ratio.
+  double error{0.};
+};
+
+//! @brief Extract the value of a field from a JSON line record.
+//!
+//! @details Only the flat records of the `record` function are supported.
+std::string json_field(std::string_view line, std::string_view field) {
+  const auto name{std::format("\"{}\": ", field)};
+  const auto start{line.find(name)};
+  if (start == std::string_view::npos) {
+    return {};
+  }
+  auto value{line.substr(start + name.size())};
+  if (value.starts_with('"')) {
+    return std::string{value.substr(1, value.find('"', 1) - 1)};
+  }
+  return std::string{value.substr(0, value.find_first_of(",}"))};
+}
+
+//! @brief Read the records of a results file.
+//!
+//! @details Files with the `.json` extension are read as JSON lines, other
+//! files as semicolon-separated values. The last record of a key wins, such
+//! that appended runs compare their most recent results.
+std::map<key, measurement> read(const std::string &path) {
+  std::map<key, measurement> records;
+  std::ifstream file{path};
+  const bool json{path.ends_with(".json")};
+  std::string line;
+
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+
+    if (json) {
+      records[{json_field(line, "title"), json_field(line, "name"),
+               json_field(line, "size")}] = {
+          std::stod(json_field(line, "median(elapsed)")),
+          std::stod(json_field(line, "medianAbsolutePercentError(elapsed)"))};
+    } else {
+      std::string fields[5];
+      std::size_t start{0};
+      for (auto &field : fields) {
+        const auto end{line.find(';', start)};
+        field = line.substr(start, end - start);
+        if (field.size() >= 2 && field.front() == '"') {
+          field = field.substr(1, field.size() - 2);
+        }
+        start = end == std::string::npos ? line.size() : end + 1;
+      }
+      records[{fields[0], fields[1], fields[2]}] = {std::stod(fields[3]),
+                                                    std::stod(fields[4])};
+    }
+  }
+
+  return records;
+}
+} // namespace
+
+//! @brief Main entry point for benchmark result regression comparison.
+//! @details Compares the benchmark results of a run against a stored baseline
+//!          and prints the relative change of each result. A result regresses
+//!          when its median elapsed time grows beyond the elapsed threshold
+//!          ratio of its baseline. A result is unstable when its median
+//!          absolute percent error exceeds the error threshold ratio, its
+//!          elapsed time is noisy. Unstable results are reported without
+//!          failing, an unstable result regressing still fails. Results
+//!          missing from either side are reported without failing.
+//!
+//!          Usage: `compare <baseline> <results> [elapsed threshold]
+//!          [error threshold]`, with thresholds defaulting to `0.1` and `0.05`.
+//! @return EXIT_SUCCESS when no result regresses, EXIT_FAILURE otherwise or
+//!         on error.
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: compare <baseline> <results> [elapsed threshold] "
+                 "[error threshold]\n";
+    return EXIT_FAILURE;
+  }
+
+  const auto baseline{read(argv[1])};
+  const auto results{read(argv[2])};
+  const double elapsed_threshold{argc > 3 ? std::stod(argv[3]) : 0.1};
+  const double error_threshold{argc > 4 ? std::stod(argv[4]) : 0.05};
+
+  if (baseline.empty() || results.empty()) {
+    std::cerr << "No baseline or results records to compare.\n";
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "| Title | Name | Size | Baseline (s) | Result (s) | Change (%) "
+               "| Error (%) | Status |\n"
+               "| --- | --- | --- | --- | --- | --- | --- | --- |\n";
+
+  bool failed{false};
+  for (const auto &[record, result] : results) {
+    const auto &[title, name, size]{record};
+    const auto found{baseline.find(record)};
+    if (found == baseline.end()) {
+      std::cout << std::format("| {} | {} | {} | | {} | | {} | new |\n", title,
+                               name, size, result.elapsed,
+                               result.error * 100.);
+      continue;
+    }
+
+    const auto change{result.elapsed / found->second.elapsed - 1.};
+    const bool unstable{result.error > error_threshold};
+    const bool regression{change > elapsed_threshold};
+    std::string_view status{"ok"};
+    if (regression) {
+      status = unstable ? "unstable regression" : "regression";
+      failed = true;
+    } else if (unstable) {
+      status = "unstable";
+    }
+    std::cout << std::format("| {} | {} | {} | {} | {} | {:+.2f} | {:.2f} | {} "
+                             "|\n",
+                             title, name, size, found->second.elapsed,
+                             result.elapsed, change * 100.,
+                             result.error * 100., status);
+  }
+
+  for (const auto &[record, result] : baseline) {
+    if (!results.contains(record)) {
+      const auto &[title, name, size]{record};
+      std::cout << std::format("| {} | {} | {} | {} | | | | missing |\n",
+                               title, name, size, result.elapsed);
+    }
+  }
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -29,6 +29,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 For more information, please refer to <https://unlicense.org> */
 
+#include "fcarouge/benchmark.hpp"
+
 #include <Eigen/Eigen>
 #include <nanobench.h>
 
@@ -62,14 +64,16 @@ template <auto Size> void bench() {
   }
 
   std::ofstream results{"results.txt", std::ios::app};
-  ankerl::nanobench::Bench()
-      .output(nullptr)
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr)
+      .performanceCounters(true)
       .title("Eigen::Matrix")
       .run([&]() {
         Eigen::Matrix<double, Size, Size> r{a * b};
         ankerl::nanobench::doNotOptimizeAway(r);
-      })
-      .render(csv<Size>.c_str(), results);
+      });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
 }
 } // namespace
 } // namespace fcarouge::benchmark
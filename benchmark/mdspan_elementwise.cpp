@@ -0,0 +1,120 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <linalg>
+#include <mdspan>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+template <auto Size>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    Size, Size)};
+
+//! @benchmark `std::mdspan` square matrix element-wise operations.
+//!
+//! @details The transposition is a view, it is not evaluated.
+template <auto Size> void bench() {
+  std::vector<double> storage_a(Size * Size);
+  std::vector<double> storage_b(Size * Size);
+  std::vector<double> storage_r(Size * Size);
+  std::vector<double> storage_v(Size);
+  std::mdspan a{storage_a.data(), std::extents<std::size_t, Size, Size>{}};
+  std::mdspan b{storage_b.data(), std::extents<std::size_t, Size, Size>{}};
+  std::mdspan r{storage_r.data(), std::extents<std::size_t, Size, Size>{}};
+  std::mdspan v{storage_v.data(), std::extents<std::size_t, Size>{}};
+  std::random_device device;
+  std::mt19937 generator{device()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    for (std::size_t j{0}; j < Size; ++j) {
+      a(i, j) = distribution(generator);
+      b(i, j) = distribution(generator);
+    }
+    v(i) = distribution(generator);
+  }
+
+  std::ofstream results{"results.txt", std::ios::app};
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr).performanceCounters(true).title("std::mdspan");
+  bench.run("add", [&]() {
+    std::linalg::add(a, b, r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("subtract", [&]() {
+    std::linalg::add(a, std::linalg::scaled(-1., b), r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("negate", [&]() {
+    std::linalg::copy(std::linalg::scaled(-1., a), r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("scale", [&]() {
+    std::linalg::scale(2., r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("transpose", [&]() {
+    auto t{std::linalg::transposed(a)};
+    ankerl::nanobench::doNotOptimizeAway(t);
+  });
+  bench.run("equality", [&]() {
+    bool equal{true};
+    for (std::size_t i{0}; i < Size; ++i) {
+      for (std::size_t j{0}; j < Size; ++j) {
+        equal &= a(i, j) == b(i, j);
+      }
+    }
+    ankerl::nanobench::doNotOptimizeAway(equal);
+  });
+  bench.run("magnitude", [&]() {
+    double norm{std::linalg::vector_two_norm(v)};
+    ankerl::nanobench::doNotOptimizeAway(norm);
+  });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -48,7 +48,20 @@ For more information, please refer to <https://unlicense.org> */
 //! @details Reads benchmark results from results.txt, parses the data,
 //!          and generates a visualization plot showing performance metrics
 //!          across different matrix sizes and methods. Saves the plot as
-//!          plot.png.
+//!          plot.png. Results reporting the overhead ratio of a typed
+//!          expression over its untyped equivalent are also visualized and
+//!          saved as overhead.png. The hardware performance counters of the
+//!          machine-readable results.csv, or results.json, records are
+//!          visualized as instructions per operation, instructions per cycle,
+//!          and branch miss rate, saved as instructions.png, ipc.png, and
+//!          branch_misses.png, when available. The compile-time benchmark
+//!          records of compile.csv are visualized as the compilation wall
+//!          time, with the template instantiation totals of the Clang time
+//!          trace when available, the compiler peak memory, and the object
+//!          file size, saved as compile_time.png, compile_memory.png, and
+//!          compile_size.png. The counts of the library metafunctions
+//!          instantiations are saved as compile_instantiations.png, when
+//!          available.
 //! @return EXIT_SUCCESS on successful execution, EXIT_FAILURE on error.
 int main() {
 #if defined(_WIN32)
@@ -76,6 +89,7 @@ int main() {
 
   std::string line;
   std::map<std::string, std::vector<std::pair<double, double>>> series_data;
+  std::map<std::string, std::vector<std::pair<double, double>>> overhead_data;
 
   auto trim{[](std::string &value) {
     value.erase(value.begin(),
@@ -124,42 +138,171 @@ int main() {
       const auto size{std::stod(size_str)};
 
       series_data[method].emplace_back(size, time);
+
+      if (tokens.size() >= 5) {
+        overhead_data[method].emplace_back(size, std::stod(tokens[4]));
+      }
     }
   }
 
-  auto figure{matplot::figure()};
-  figure->size(1200, 800);
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      instructions_data;
+  std::map<std::string, std::vector<std::pair<double, double>>> ipc_data;
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      branch_misses_data;
 
-  std::vector<std::string> methods;
-  methods.reserve(series_data.size());
-  std::ranges::transform(series_data, std::back_inserter(methods),
-                         [](const auto &point) { return point.first; });
+  const bool json{!std::filesystem::exists("results.csv")};
+  std::ifstream records{json ? "results.json" : "results.csv"};
 
-  std::sort(methods.begin(), methods.end());
+  auto field{[json](const std::string &record, std::size_t index,
+                    const std::string &name) {
+    std::string value;
+    if (json) {
+      const auto key{"\"" + name + "\": "};
+      const auto start{record.find(key)};
+      if (start != std::string::npos) {
+        value = record.substr(start + key.size());
+        value = value.substr(0, value.find_first_of(",}"));
+      }
+    } else {
+      std::size_t start{0};
+      for (std::size_t i{0}; i < index && start != std::string::npos; ++i) {
+        start = record.find(';', start);
+        start = start == std::string::npos ? start : start + 1;
+      }
+      if (start != std::string::npos) {
+        value = record.substr(start, record.find(';', start) - start);
+      }
+    }
+    std::erase(value, '"');
+    trim(value);
+    return value;
+  }};
 
-  for (const auto &method : methods) {
-    auto points{series_data[method]};
-    std::sort(points.begin(), points.end());
+  while (std::getline(records, line)) {
+    if (line.empty()) {
+      continue;
+    }
 
-    std::vector<double> sorted_sizes;
-    std::vector<double> sorted_times;
-    sorted_sizes.reserve(points.size());
-    sorted_times.reserve(points.size());
-    std::ranges::transform(points, std::back_inserter(sorted_sizes),
-                           [](const auto &point) { return point.first; });
-    std::ranges::transform(points, std::back_inserter(sorted_times),
-                           [](const auto &point) { return point.second; });
-
-    auto line_plot{matplot::plot(sorted_sizes, sorted_times, "o-")};
-    line_plot->display_name(method);
-    line_plot->line_width(2.5);
-    line_plot->marker_size(8);
-    matplot::hold(matplot::on);
+    auto method{field(line, 0, "title")};
+    if (const auto name{field(line, 1, "name")}; name != "noname") {
+      method += " " + name;
+    }
+    auto size_str{field(line, 2, "size")};
+    size_str = size_str.substr(0, size_str.find('x'));
+    const auto instructions_str{field(line, 5, "median(instructions)")};
+    const auto cycles_str{field(line, 6, "median(cpucycles)")};
+    const auto branches_str{field(line, 7, "median(branchinstructions)")};
+    const auto misses_str{field(line, 8, "median(branchmisses)")};
+    if (size_str.empty() || instructions_str.empty() || cycles_str.empty() ||
+        branches_str.empty() || misses_str.empty()) {
+      continue;
+    }
+
+    const auto size{std::stod(size_str)};
+    const auto instructions{std::stod(instructions_str)};
+    const auto cycles{std::stod(cycles_str)};
+    const auto branches{std::stod(branches_str)};
+    const auto misses{std::stod(misses_str)};
+
+    if (instructions > 0.) {
+      instructions_data[method].emplace_back(size, instructions);
+    }
+    if (instructions > 0. && cycles > 0.) {
+      ipc_data[method].emplace_back(size, instructions / cycles);
+    }
+    if (branches > 0.) {
+      branch_misses_data[method].emplace_back(size, misses / branches * 100.);
+    }
   }
 
-  matplot::xlabel("Matrix Size NxN");
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      compile_time_data;
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      compile_memory_data;
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      compile_size_data;
+  std::map<std::string, std::vector<std::pair<double, double>>>
+      compile_instantiations_data;
+
+  std::ifstream compile_records{"compile.csv"};
+  while (std::getline(compile_records, line)) {
+    std::vector<std::string> values;
+    std::istringstream record{line};
+    for (std::string value; std::getline(record, value, ';');) {
+      std::erase(value, '"');
+      values.push_back(std::move(value));
+    }
+    if (values.size() < 8) {
+      continue;
+    }
+
+    const auto &method{values[0]};
+    const auto size{std::stod(values[1])};
+    const auto wall{std::stod(values[2])};
+    const auto peak_rss{std::stod(values[3])};
+    const auto instantiation{std::stod(values[6]) + std::stod(values[7])};
+
+    compile_time_data[method + " wall"].emplace_back(size, wall);
+    if (instantiation > 0.) {
+      compile_time_data[method + " instantiation"].emplace_back(size,
+                                                               instantiation);
+    }
+    if (peak_rss > 0.) {
+      compile_memory_data[method].emplace_back(size, peak_rss / 1e6);
+    }
+    if (values.size() > 8) {
+      compile_size_data[method].emplace_back(size, std::stod(values[8]) / 1e3);
+    }
+    if (values.size() > 11) {
+      for (const auto &[index, metafunction] :
+           {std::pair<std::size_t, std::string>{9, "element_at"},
+            {10, "product"},
+            {11, "quotient"}}) {
+        const auto count{std::stod(values[index])};
+        if (count > 0.) {
+          compile_instantiations_data[method + " " + metafunction].emplace_back(
+              size, count);
+        }
+      }
+    }
+  }
+
+  auto plot{[](auto &data) {
+    std::vector<std::string> methods;
+    methods.reserve(data.size());
+    std::ranges::transform(data, std::back_inserter(methods),
+                           [](const auto &point) { return point.first; });
+
+    std::sort(methods.begin(), methods.end());
+
+    for (const auto &method : methods) {
+      auto points{data[method]};
+      std::sort(points.begin(), points.end());
+
+      std::vector<double> sorted_sizes;
+      std::vector<double> sorted_values;
+      sorted_sizes.reserve(points.size());
+      sorted_values.reserve(points.size());
+      std::ranges::transform(points, std::back_inserter(sorted_sizes),
+                             [](const auto &point) { return point.first; });
+      std::ranges::transform(points, std::back_inserter(sorted_values),
+                             [](const auto &point) { return point.second; });
+
+      auto line_plot{matplot::plot(sorted_sizes, sorted_values, "o-")};
+      line_plot->display_name(method);
+      line_plot->line_width(2.5);
+      line_plot->marker_size(8);
+      matplot::hold(matplot::on);
+    }
+  }};
+
+  auto figure{matplot::figure()};
+  figure->size(1200, 800);
+  plot(series_data);
+  matplot::xlabel("Matrix Size N");
   matplot::ylabel("Time (ns)");
-  matplot::title("Matrix-Matrix Product - MSVC 19.50.35728.0 - x64 Release");
+  matplot::title("Typed Linear Algebra - MSVC 19.50.35728.0 - x64 Release");
   matplot::legend()->location(matplot::legend::general_alignment::bottomright);
   matplot::grid(matplot::on);
   matplot::gca()->x_axis().scale(matplot::axis_type::axis_scale::log);
@@ -168,5 +311,59 @@ int main() {
   matplot::xticks({1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0});
   matplot::save("plot.png");
 
+  if (!overhead_data.empty()) {
+    auto overhead_figure{matplot::figure()};
+    overhead_figure->size(1200, 800);
+    plot(overhead_data);
+    matplot::xlabel("State Size N");
+    matplot::ylabel("Typed Over Untyped Time Ratio");
+    matplot::title("Covariance Update Overhead");
+    matplot::legend()->location(matplot::legend::general_alignment::topright);
+    matplot::grid(matplot::on);
+    matplot::gca()->x_axis().scale(matplot::axis_type::axis_scale::log);
+    matplot::xlim({1.0, 128.0});
+    matplot::xticks({1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0});
+    matplot::save("overhead.png");
+  }
+
+  auto plot_trend{[&plot](auto &data, const std::string &label,
+                            const std::string &title, const std::string &path,
+                            bool logarithmic) {
+    if (data.empty()) {
+      return;
+    }
+    auto counter_figure{matplot::figure()};
+    counter_figure->size(1200, 800);
+    plot(data);
+    matplot::xlabel("Matrix Size N");
+    matplot::ylabel(label);
+    matplot::title(title);
+    matplot::legend()->location(matplot::legend::general_alignment::topleft);
+    matplot::grid(matplot::on);
+    matplot::gca()->x_axis().scale(matplot::axis_type::axis_scale::log);
+    if (logarithmic) {
+      matplot::gca()->y_axis().scale(matplot::axis_type::axis_scale::log);
+    }
+    matplot::xlim({1.0, 256.0});
+    matplot::xticks({1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0});
+    matplot::save(path);
+  }};
+
+  plot_trend(instructions_data, "Instructions Per Operation",
+               "Instructions Per Operation", "instructions.png", true);
+  plot_trend(ipc_data, "Instructions Per Cycle", "Instructions Per Cycle",
+               "ipc.png", false);
+  plot_trend(branch_misses_data, "Branch Misses (%)", "Branch Miss Rate",
+               "branch_misses.png", false);
+  plot_trend(compile_time_data, "Compilation Time (s)", "Compilation Time",
+               "compile_time.png", true);
+  plot_trend(compile_memory_data, "Compiler Peak Memory (MB)",
+               "Compiler Peak Memory", "compile_memory.png", true);
+  plot_trend(compile_size_data, "Object File Size (kB)", "Object File Size",
+               "compile_size.png", true);
+  plot_trend(compile_instantiations_data, "Distinct Instantiations",
+             "Library Metafunctions Instantiations",
+             "compile_instantiations.png", true);
+
   return EXIT_SUCCESS;
 }
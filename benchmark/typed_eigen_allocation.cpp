@@ -0,0 +1,158 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Heap allocations of the typed Eigen operations.
+//!
+//! @details Each operation is invoked once to warm up its lazily allocated
+//! state before its allocations are accounted on a second invocation. The
+//! allocation counts and bytes are appended to `allocations.txt` as markdown
+//! table rows next to the timing of the operation.
+
+#include "fcarouge/allocation.hpp"
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace fcarouge::benchmark {
+namespace {
+template <auto Size>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    Size, Size)};
+
+//! @brief Fill a uniform typed matrix of any rank with random values.
+template <typename Matrix> void fill(Matrix &value, std::mt19937 &generator) {
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t i{0}; i < Matrix::rows; ++i) {
+    for (std::size_t j{0}; j < Matrix::columns; ++j) {
+      if constexpr (Matrix::rank == 2) {
+        value(i, j) = distribution(generator);
+      } else if constexpr (Matrix::rank == 1) {
+        value(i + j) = distribution(generator);
+      } else {
+        value = distribution(generator);
+      }
+    }
+  }
+}
+
+//! @brief Time an operation and report its heap allocations.
+template <auto Size>
+void measure(ankerl::nanobench::Bench &bench, std::ofstream &report,
+             const std::string &name, auto &&operation) {
+  operation();
+  const allocations allocation{allocations_of(operation)};
+  report << std::format("| ${BACKEND} {} | {:5d}x{:<5d} | {} | {} |\n", name,
+                        Size, Size, allocation.count, allocation.bytes);
+  bench.run(name, operation);
+}
+
+//! @benchmark Typed Eigen square matrix operations heap allocations.
+template <auto Size> void bench() {
+  matrix<double, Size, Size> a;
+  matrix<double, Size, Size> b;
+  matrix<double, Size, Size> r;
+  column_vector<double, Size> v;
+  column_vector<double, Size> w;
+  std::string text;
+  std::random_device device;
+  std::mt19937 generator{device()};
+
+  fill(a, generator);
+  fill(b, generator);
+  fill(v, generator);
+
+  std::ofstream results{"results.txt", std::ios::app};
+  std::ofstream report{"allocations.txt", std::ios::app};
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr).performanceCounters(true).title("${BACKEND}");
+  measure<Size>(bench, report, "copy", [&]() {
+    r = a;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "add", [&]() {
+    r = a + b;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "subtract", [&]() {
+    r = a - b;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "scale", [&]() {
+    r = a * 2.;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "transpose", [&]() {
+    r = transposed(a);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "product", [&]() {
+    r = a * b;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  measure<Size>(bench, report, "matrix-vector product", [&]() {
+    w = a * v;
+    ankerl::nanobench::doNotOptimizeAway(w);
+  });
+  measure<Size>(bench, report, "at", [&]() {
+    r.template at<0, 0>(a.template at<Size - 1, Size - 1>());
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  // The division solves with a decomposition of the divisor.
+  if constexpr (requires { a / b; }) {
+    measure<Size>(bench, report, "divide", [&]() {
+      r = a / b;
+      ankerl::nanobench::doNotOptimizeAway(r);
+    });
+  }
+  // The Eigen formatter streams through a string stream.
+  measure<Size>(bench, report, "format", [&]() {
+    text = std::format("{}", a);
+    ankerl::nanobench::doNotOptimizeAway(text);
+  });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -0,0 +1,54 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Compile-time benchmark of the typed Eigen square matrix product,
+//! addition, and formatting.
+//!
+//! @details The translation unit is only compiled, its compilation is measured.
+//! The fixed size matrices are never allocated, lifting the Eigen stack
+//! allocation limit to compile the largest sizes.
+
+#define EIGEN_STACK_ALLOCATION_LIMIT 0
+
+#include "fcarouge/linalg.hpp"
+
+#include <format>
+#include <string>
+
+namespace fcarouge::benchmark {
+//! @benchmark Instantiates the typed square matrix product, addition, and
+//! formatting.
+std::string compile(const matrix<double, ${SIZE}, ${SIZE}> &a,
+                    const matrix<double, ${SIZE}, ${SIZE}> &b) {
+  return std::format("{}", a * b + a);
+}
+} // namespace fcarouge::benchmark
@@ -0,0 +1,142 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <Eigen/Eigen>
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace fcarouge::benchmark {
+namespace {
+//! @brief Result row format, including the overhead ratio of the typed
+//! expression over its untyped equivalent.
+template <auto State, auto Output> std::string markdown_row(double overhead) {
+  return std::format(
+      "{{{{#result}}}}| {{{{title}}}} | {:5d}x{:<5d} | {{{{median(elapsed)}}}} "
+      "| {{{{medianAbsolutePercentError(elapsed)}}}} | {} |{{{{/result}}}}\n",
+      State, Output, overhead);
+}
+
+//! @brief Copy the elements of an untyped matrix into a typed matrix of any
+//! rank.
+template <typename Typed, typename Untyped>
+void assign(Typed &typed, const Untyped &untyped) {
+  for (std::size_t j{0}; j < Typed::rows; ++j) {
+    for (std::size_t l{0}; l < Typed::columns; ++l) {
+      if constexpr (Typed::rank == 2) {
+        typed(j, l) = untyped(j, l);
+      } else if constexpr (Typed::rank == 1) {
+        typed(j + l) = untyped(j, l);
+      } else {
+        typed = untyped(j, l);
+      }
+    }
+  }
+}
+
+//! @benchmark Typed Eigen estimate uncertainty covariance update of a Kalman
+//! filter, relative to the untyped Eigen equivalent.
+template <auto State, auto Output> void bench() {
+  const Eigen::Matrix<double, State, State> i{
+      Eigen::Matrix<double, State, State>::Identity()};
+  Eigen::Matrix<double, State, State> p;
+  Eigen::Matrix<double, State, State> updated_p;
+  Eigen::Matrix<double, State, Output> k;
+  Eigen::Matrix<double, Output, State> h;
+  Eigen::Matrix<double, Output, Output> r;
+  std::random_device device;
+  std::mt19937 generator{device()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t j{0}; j < State; ++j) {
+    for (std::size_t l{0}; l < State; ++l) {
+      p(j, l) = distribution(generator);
+    }
+    for (std::size_t l{0}; l < Output; ++l) {
+      k(j, l) = distribution(generator);
+      h(l, j) = distribution(generator);
+    }
+  }
+  for (std::size_t j{0}; j < Output; ++j) {
+    for (std::size_t l{0}; l < Output; ++l) {
+      r(j, l) = distribution(generator);
+    }
+  }
+
+  matrix<double, State, State> typed_i;
+  matrix<double, State, State> typed_p;
+  matrix<double, State, State> typed_updated_p;
+  matrix<double, State, Output> typed_k;
+  matrix<double, Output, State> typed_h;
+  matrix<double, Output, Output> typed_r;
+  assign(typed_i, i);
+  assign(typed_p, p);
+  assign(typed_k, k);
+  assign(typed_h, h);
+  assign(typed_r, r);
+
+  ankerl::nanobench::Bench baseline;
+  baseline.output(nullptr).performanceCounters(true).run([&]() {
+    updated_p =
+        (i - k * h) * p * (i - k * h).transpose() + k * r * k.transpose();
+    ankerl::nanobench::doNotOptimizeAway(updated_p);
+  });
+
+  ankerl::nanobench::Bench typed;
+  typed.output(nullptr)
+      .performanceCounters(true)
+      .title("${BACKEND} covariance update")
+      .run([&]() {
+        typed_updated_p = (typed_i - typed_k * typed_h) * typed_p *
+                              transposed(typed_i - typed_k * typed_h) +
+                          typed_k * typed_r * transposed(typed_k);
+        ankerl::nanobench::doNotOptimizeAway(typed_updated_p);
+      });
+
+  constexpr auto elapsed{ankerl::nanobench::Result::Measure::elapsed};
+  const double overhead{typed.results().front().median(elapsed) /
+                        baseline.results().front().median(elapsed)};
+
+  std::ofstream results{"results.txt", std::ios::app};
+  typed.render(markdown_row<State, Output>(overhead).c_str(), results);
+  record(typed, std::format("{}x{}", State, Output), overhead);
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZES}>(); }
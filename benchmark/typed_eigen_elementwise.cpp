@@ -0,0 +1,122 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace fcarouge::benchmark {
+namespace {
+template <auto Size>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    Size, Size)};
+
+//! @brief Fill a uniform typed matrix of any rank with random values.
+template <typename Matrix> void fill(Matrix &value, std::mt19937 &generator) {
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t i{0}; i < Matrix::rows; ++i) {
+    for (std::size_t j{0}; j < Matrix::columns; ++j) {
+      if constexpr (Matrix::rank == 2) {
+        value(i, j) = distribution(generator);
+      } else if constexpr (Matrix::rank == 1) {
+        value(i + j) = distribution(generator);
+      } else {
+        value = distribution(generator);
+      }
+    }
+  }
+}
+
+//! @benchmark Typed Eigen square matrix element-wise operations.
+template <auto Size> void bench() {
+  matrix<double, Size, Size> a;
+  matrix<double, Size, Size> b;
+  matrix<double, Size, Size> r;
+  column_vector<double, Size> v;
+  std::random_device device;
+  std::mt19937 generator{device()};
+
+  fill(a, generator);
+  fill(b, generator);
+  fill(v, generator);
+
+  std::ofstream results{"results.txt", std::ios::app};
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr).performanceCounters(true).title("${BACKEND}");
+  bench.run("add", [&]() {
+    r = a + b;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("subtract", [&]() {
+    r = a - b;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("negate", [&]() {
+    r = -a;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("scale", [&]() {
+    r = a * 2.;
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("transpose", [&]() {
+    r = transposed(a);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("equality", [&]() {
+    bool equal{a == b};
+    ankerl::nanobench::doNotOptimizeAway(equal);
+  });
+  // The magnitude is only defined for vectors, not for singletons.
+  if constexpr (Size > 1) {
+    bench.run("magnitude", [&]() {
+      double norm{magnitude(v)};
+      ankerl::nanobench::doNotOptimizeAway(norm);
+    });
+  }
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -0,0 +1,241 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_parallel_algorithm
+#include <execution>
+#endif
+
+namespace fcarouge::benchmark {
+namespace {
+//! @brief Number of independent filters updated per operation.
+constexpr std::size_t filters{4096};
+
+template <auto State>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    State, filters)};
+
+//! @brief Typed state and covariance pair of one filter, packed contiguously
+//! in the vector of filters.
+template <auto State> struct packed {
+  static constexpr std::size_t state{State};
+
+  column_vector<double, State> x;
+  matrix<double, State, State> p;
+};
+
+//! @brief Typed state and covariance pair of one filter, padded to its own
+//! cache lines in the vector of filters.
+template <auto State>
+struct alignas(std::hardware_destructive_interference_size) padded
+    : packed<State> {};
+
+//! @brief Pool of threads repeatedly processing their share of the filters.
+//!
+//! @details The threads are started once and synchronized per operation such
+//! that the measurements exclude the thread creation.
+class pool {
+public:
+  pool(std::size_t threads, std::function<void(std::size_t)> work)
+      : start{static_cast<std::ptrdiff_t>(threads + 1)},
+        done{static_cast<std::ptrdiff_t>(threads + 1)} {
+    for (std::size_t thread{0}; thread < threads; ++thread) {
+      workers.emplace_back([this, thread, work]() {
+        while (true) {
+          start.arrive_and_wait();
+          if (stopping) {
+            return;
+          }
+          work(thread);
+          done.arrive_and_wait();
+        }
+      });
+    }
+  }
+
+  pool(const pool &) = delete;
+  pool &operator=(const pool &) = delete;
+
+  ~pool() {
+    stopping = true;
+    start.arrive_and_wait();
+  }
+
+  //! @brief Process all the shares of the filters once.
+  void run() {
+    start.arrive_and_wait();
+    done.arrive_and_wait();
+  }
+
+private:
+  std::barrier<> start;
+  std::barrier<> done;
+  std::atomic<bool> stopping{false};
+  std::vector<std::jthread> workers;
+};
+
+//! @brief Measure the prediction of the filters of a layout sequentially, in
+//! parallel, and over a sweep of thread counts.
+//!
+//! @details The chunked distribution gives each thread a contiguous range of
+//! filters. The interleaved distribution gives adjacent filters to different
+//! threads, exposing the false sharing of filters sharing a cache line.
+template <typename Filter>
+void measure(const std::string &layout, const auto &f, const auto &q,
+             std::ofstream &results, const std::string &row) {
+  std::vector<Filter> estimators(filters);
+  std::mt19937 generator{std::random_device{}()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+  for (auto &estimator : estimators) {
+    for (std::size_t i{0}; i < Filter::state; ++i) {
+      estimator.x(i) = distribution(generator);
+      for (std::size_t j{0}; j < Filter::state; ++j) {
+        estimator.p(i, j) = distribution(generator);
+      }
+    }
+  }
+
+  auto predict{[&f, &q](Filter &estimator) {
+    estimator.x = f * estimator.x;
+    estimator.p = f * estimator.p * transposed(f) + q;
+  }};
+
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr)
+      .performanceCounters(true)
+      .batch(filters)
+      .unit("filter")
+      .title(std::format("${BACKEND} {} filters, {} bytes, {} aligned", layout,
+                         sizeof(Filter), alignof(Filter)));
+
+  bench.run("sequential", [&]() {
+    std::ranges::for_each(estimators, predict);
+    ankerl::nanobench::doNotOptimizeAway(estimators);
+  });
+
+#ifdef __cpp_lib_parallel_algorithm
+  bench.run("par_unseq", [&]() {
+    std::for_each(std::execution::par_unseq, estimators.begin(),
+                  estimators.end(), predict);
+    ankerl::nanobench::doNotOptimizeAway(estimators);
+  });
+#endif
+
+  std::vector<std::size_t> sweep;
+  const std::size_t concurrency{
+      std::max(std::thread::hardware_concurrency(), 1U)};
+  for (std::size_t threads{1}; threads < concurrency; threads *= 2) {
+    sweep.push_back(threads);
+  }
+  sweep.push_back(concurrency);
+
+  for (const std::size_t threads : sweep) {
+    pool chunked{threads, [&estimators, &predict, threads](std::size_t thread) {
+                   const std::size_t begin{filters * thread / threads};
+                   const std::size_t end{filters * (thread + 1) / threads};
+                   for (std::size_t i{begin}; i < end; ++i) {
+                     predict(estimators[i]);
+                   }
+                 }};
+    bench.run(std::format("chunked {} threads", threads), [&]() {
+      chunked.run();
+      ankerl::nanobench::doNotOptimizeAway(estimators);
+    });
+
+    pool interleaved{
+        threads, [&estimators, &predict, threads](std::size_t thread) {
+          for (std::size_t i{thread}; i < filters; i += threads) {
+            predict(estimators[i]);
+          }
+        }};
+    bench.run(std::format("interleaved {} threads", threads), [&]() {
+      interleaved.run();
+      ankerl::nanobench::doNotOptimizeAway(estimators);
+    });
+  }
+
+  bench.render(row.c_str(), results);
+  record(bench, std::format("{}x{}", Filter::state, filters));
+}
+
+//! @benchmark Typed Eigen throughput of many independent filters' predictions
+//! across threads.
+//!
+//! @details Each filter predicts its state and covariance `x = f * x` and `p =
+//! f * p * t(f) + q`. The packed layout shares cache lines between adjacent
+//! filters for small states, the padded layout does not.
+template <auto State> void bench() {
+  matrix<double, State, State> f;
+  matrix<double, State, State> q;
+  std::mt19937 generator{std::random_device{}()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+  for (std::size_t i{0}; i < State; ++i) {
+    double sum{0.};
+    for (std::size_t j{0}; j < State; ++j) {
+      f(i, j) = distribution(generator);
+      q(i, j) = distribution(generator);
+      sum += f(i, j);
+    }
+    // Rows summing to one keep the repeated predictions finite and non-zero.
+    for (std::size_t j{0}; j < State; ++j) {
+      f(i, j) /= sum;
+    }
+  }
+
+  std::ofstream results{"results.txt", std::ios::app};
+  measure<packed<State>>("packed", f, q, results, csv<State>);
+  measure<padded<State>>("padded", f, q, results, csv<State>);
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -0,0 +1,58 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Compile-time benchmark of the compile-time indexes iteration, by
+//! chunked folds.
+//!
+//! @details The translation unit is only compiled, its compilation and object
+//! size are measured against the `typed_eigen_for_constexpr_compile`
+//! benchmark. The fixed size matrices are never allocated, lifting the Eigen
+//! stack allocation limit to compile the largest sizes.
+
+#define EIGEN_STACK_ALLOCATION_LIMIT 0
+
+#include "fcarouge/linalg.hpp"
+
+namespace fcarouge::benchmark {
+//! @benchmark Sums every element of the typed square matrix by compile-time
+//! indexes.
+double compile(const matrix<double, ${SIZE}, ${SIZE}> &a) {
+  double sum{0.};
+
+  typed_linear_algebra_internal::for_constexpr_chunked<${SIZE} * ${SIZE}>(
+      [&a, &sum](auto position) {
+        sum += a.template at<position / ${SIZE}, position % ${SIZE}>();
+      });
+
+  return sum;
+}
+} // namespace fcarouge::benchmark
@@ -0,0 +1,158 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <linalg>
+#include <mdspan>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+//! @brief Result row format, including the overhead ratio of the typed
+//! expression over its untyped equivalent.
+template <auto State, auto Output> std::string markdown_row(double overhead) {
+  return std::format(
+      "{{{{#result}}}}| {{{{title}}}} | {:5d}x{:<5d} | {{{{median(elapsed)}}}} "
+      "| {{{{medianAbsolutePercentError(elapsed)}}}} | {} |{{{{/result}}}}\n",
+      State, Output, overhead);
+}
+
+//! @brief Typed matrix of uniform, double, indexes with mp-units and
+//! `std::mdspan`.
+template <auto Rows, auto Columns>
+using uniform_matrix =
+    matrix<double, typed_linear_algebra_internal::tuple_n_type<double, Rows>,
+           typed_linear_algebra_internal::tuple_n_type<double, Columns>>;
+
+//! @benchmark Typed `std::mdspan` estimate uncertainty covariance update of a
+//! Kalman filter written as one lazily evaluated expression, lowered to
+//! `std::linalg` calls on assignment, relative to the untyped `std::mdspan`
+//! equivalent.
+template <auto State, auto Output> void bench() {
+  std::vector<double> storage_i(State * State);
+  std::vector<double> storage_p(State * State);
+  std::vector<double> storage_updated_p(State * State);
+  std::vector<double> storage_k(State * Output);
+  std::vector<double> storage_h(Output * State);
+  std::vector<double> storage_r(Output * Output);
+  std::vector<double> storage_kh(State * State);
+  std::vector<double> storage_a(State * State);
+  std::vector<double> storage_ap(State * State);
+  std::vector<double> storage_apa(State * State);
+  std::vector<double> storage_kr(State * Output);
+  std::vector<double> storage_krk(State * State);
+  std::mdspan i{storage_i.data(), std::extents<std::size_t, State, State>{}};
+  std::mdspan p{storage_p.data(), std::extents<std::size_t, State, State>{}};
+  std::mdspan updated_p{storage_updated_p.data(),
+                        std::extents<std::size_t, State, State>{}};
+  std::mdspan k{storage_k.data(), std::extents<std::size_t, State, Output>{}};
+  std::mdspan h{storage_h.data(), std::extents<std::size_t, Output, State>{}};
+  std::mdspan r{storage_r.data(), std::extents<std::size_t, Output, Output>{}};
+  std::mdspan kh{storage_kh.data(), std::extents<std::size_t, State, State>{}};
+  std::mdspan a{storage_a.data(), std::extents<std::size_t, State, State>{}};
+  std::mdspan ap{storage_ap.data(), std::extents<std::size_t, State, State>{}};
+  std::mdspan apa{storage_apa.data(),
+                  std::extents<std::size_t, State, State>{}};
+  std::mdspan kr{storage_kr.data(), std::extents<std::size_t, State, Output>{}};
+  std::mdspan krk{storage_krk.data(),
+                  std::extents<std::size_t, State, State>{}};
+  std::random_device device;
+  std::mt19937 generator{device()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t j{0}; j < State; ++j) {
+    i(j, j) = 1.;
+    for (std::size_t l{0}; l < State; ++l) {
+      p(j, l) = distribution(generator);
+    }
+    for (std::size_t l{0}; l < Output; ++l) {
+      k(j, l) = distribution(generator);
+      h(l, j) = distribution(generator);
+    }
+  }
+  for (std::size_t j{0}; j < Output; ++j) {
+    for (std::size_t l{0}; l < Output; ++l) {
+      r(j, l) = distribution(generator);
+    }
+  }
+
+  uniform_matrix<State, State> typed_i{i};
+  uniform_matrix<State, State> typed_p{p};
+  uniform_matrix<State, State> typed_updated_p{updated_p};
+  uniform_matrix<State, Output> typed_k{k};
+  uniform_matrix<Output, State> typed_h{h};
+  uniform_matrix<Output, Output> typed_r{r};
+
+  ankerl::nanobench::Bench baseline;
+  baseline.output(nullptr).performanceCounters(true).run([&]() {
+    std::linalg::matrix_product(k, h, kh);
+    std::linalg::scale(-1., kh);
+    std::linalg::add(i, kh, a);
+    std::linalg::matrix_product(a, p, ap);
+    std::linalg::matrix_product(ap, std::linalg::transposed(a), apa);
+    std::linalg::matrix_product(k, r, kr);
+    std::linalg::matrix_product(kr, std::linalg::transposed(k), krk);
+    std::linalg::add(apa, krk, updated_p);
+    ankerl::nanobench::doNotOptimizeAway(updated_p);
+  });
+
+  ankerl::nanobench::Bench typed;
+  typed.output(nullptr)
+      .performanceCounters(true)
+      .title("${BACKEND} expression covariance update")
+      .run([&]() {
+        typed_updated_p = (typed_i - typed_k * typed_h) * typed_p *
+                              transposed(typed_i - typed_k * typed_h) +
+                          typed_k * typed_r * transposed(typed_k);
+        ankerl::nanobench::doNotOptimizeAway(typed_updated_p);
+      });
+
+  constexpr auto elapsed{ankerl::nanobench::Result::Measure::elapsed};
+  const double overhead{typed.results().front().median(elapsed) /
+                        baseline.results().front().median(elapsed)};
+
+  std::ofstream results{"results.txt", std::ios::app};
+  typed.render(markdown_row<State, Output>(overhead).c_str(), results);
+  record(typed, std::format("{}x{}", State, Output), overhead);
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZES}>(); }
@@ -29,6 +29,7 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 For more information, please refer to <https://unlicense.org> */
 
+#include "fcarouge/benchmark.hpp"
 #include "fcarouge/typed_linear_algebra.hpp"
 
 #include <nanobench.h>
@@ -84,14 +85,16 @@ template <auto Size> void bench() {
   }
 
   std::ofstream results{"results.txt", std::ios::app};
-  ankerl::nanobench::Bench()
-      .output(nullptr)
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr)
+      .performanceCounters(true)
       .title("typed matrix from std::mdspan")
       .run([&]() {
         matrix_product(a, b, r);
         ankerl::nanobench::doNotOptimizeAway(r);
-      })
-      .render(csv<Size>.c_str(), results);
+      });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
 }
 } // namespace
 } // namespace fcarouge::benchmark
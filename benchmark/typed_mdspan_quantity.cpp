@@ -0,0 +1,149 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <mdspan>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @brief Kinematic state indexes of the given size, cycling through the
+//! position, velocity, and acceleration quantities.
+template <std::size_t Size>
+using kinematic = decltype([]<std::size_t... Indexes>(
+                               std::index_sequence<Indexes...>) {
+  return std::tuple<std::tuple_element_t<
+      Indexes % 3, std::tuple<position, velocity, acceleration>>...>{};
+}(std::make_index_sequence<Size>{}));
+
+//! @brief Inverse kinematic state indexes of the given size.
+template <std::size_t Size>
+using inverse_kinematic = decltype([]<std::size_t... Indexes>(
+                                       std::index_sequence<Indexes...>) {
+  return std::tuple<decltype(1. / std::tuple_element_t<
+                                      Indexes, kinematic<Size>>{})...>{};
+}(std::make_index_sequence<Size>{}));
+
+//! @brief Covariance of a kinematic state: heterogeneous quantity rows and
+//! columns.
+template <std::size_t Size>
+using covariance = matrix<double, kinematic<Size>, kinematic<Size>>;
+
+//! @brief Transition of a kinematic state: heterogeneous quantity rows and
+//! inverse quantity columns, multipliable with the covariance.
+template <std::size_t Size>
+using transition = matrix<double, kinematic<Size>, inverse_kinematic<Size>>;
+
+template <auto Size>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    Size, Size)};
+
+//! @benchmark Typed mp-units `std::mdspan` square matrix of heterogeneous
+//! quantities element access and operations.
+//!
+//! @details The elements flow through the mp-units element caster
+//! specializations on every typed access.
+template <auto Size> void bench() {
+  std::vector<double> storage_f(Size * Size);
+  std::vector<double> storage_p(Size * Size);
+  std::vector<double> storage_r(Size * Size);
+  std::random_device device;
+  std::mt19937 generator{device()};
+  std::uniform_real_distribution<> distribution{0., 1.};
+
+  for (std::size_t i{0}; i < Size * Size; ++i) {
+    storage_f[i] = distribution(generator);
+    storage_p[i] = distribution(generator);
+  }
+
+  transition<Size> f{std::mdspan{storage_f.data(),
+                                 std::extents<std::size_t, Size, Size>{}}};
+  covariance<Size> p{std::mdspan{storage_p.data(),
+                                 std::extents<std::size_t, Size, Size>{}}};
+  covariance<Size> r{std::mdspan{storage_r.data(),
+                                 std::extents<std::size_t, Size, Size>{}}};
+
+  std::ofstream results{"results.txt", std::ios::app};
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr).performanceCounters(true).title("${BACKEND} quantity");
+  bench.run("read", [&]() {
+    tla::for_constexpr<Size>([&](auto i) {
+      tla::for_constexpr<Size>([&](auto j) {
+        auto element{p.template at<decltype(i)::value, decltype(j)::value>()};
+        ankerl::nanobench::doNotOptimizeAway(element);
+      });
+    });
+  });
+  bench.run("write", [&]() {
+    tla::for_constexpr<Size>([&](auto i) {
+      tla::for_constexpr<Size>([&](auto j) {
+        constexpr auto row{decltype(i)::value};
+        constexpr auto column{decltype(j)::value};
+        r.template at<row, column>(p.template at<row, column>());
+      });
+    });
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("add", [&]() {
+    add(p, p, r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("scale", [&]() {
+    scale(2., r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.run("product", [&]() {
+    matrix_product(f, p, r);
+    ankerl::nanobench::doNotOptimizeAway(r);
+  });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -0,0 +1,155 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/benchmark.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <nanobench.h>
+
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <string>
+
+namespace fcarouge::benchmark {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @brief Typed matrix of uniform, double, indexes with mp-units and Eigen.
+template <auto Rows, auto Columns>
+using uniform_matrix = matrix<double, tla::tuple_n_type<double, Rows>,
+                              tla::tuple_n_type<double, Columns>>;
+
+template <auto Size>
+const std::string csv{std::format(
+    "{{{{#result}}}}| {{{{title}}}} {{{{name}}}} | {:5d}x{:<5d} | "
+    "{{{{median(elapsed)}}}} | {{{{medianAbsolutePercentError(elapsed)}}}} "
+    "|{{{{/result}}}}\n",
+    Size, Size)};
+
+//! @brief Visit the runtime indexes of a square matrix.
+template <auto Size>
+constexpr auto runtime{[](auto function) {
+  for (std::size_t i{0}; i < Size; ++i) {
+    for (std::size_t j{0}; j < Size; ++j) {
+      function(i, j);
+    }
+  }
+}};
+
+//! @brief Visit the compile-time indexes of a square matrix, the integral
+//! constants of the `_i` literals.
+template <auto Size>
+constexpr auto compile_time{[](auto function) {
+  tla::for_constexpr<Size>([&function](auto i) {
+    tla::for_constexpr<Size>([&function, i](auto j) { function(i, j); });
+  });
+}};
+
+//! @brief Measure the fill, read, and reduce of a matrix through one access
+//! path.
+void measure(ankerl::nanobench::Bench &bench, const std::string &path,
+             auto visit, auto &value, auto access) {
+  bench.run(path + " fill", [&]() {
+    visit([&](auto i, auto j) {
+      access(value, i, j) = static_cast<double>(i + j);
+    });
+    ankerl::nanobench::doNotOptimizeAway(value);
+  });
+  bench.run(path + " read", [&]() {
+    visit([&](auto i, auto j) {
+      ankerl::nanobench::doNotOptimizeAway(access(value, i, j));
+    });
+  });
+  bench.run(path + " reduce", [&]() {
+    double sum{0.};
+    visit([&](auto i, auto j) { sum += access(value, i, j); });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+}
+
+//! @benchmark Typed mp-units Eigen element access paths: runtime indexes,
+//! compile-time indexes, `_i` literal indexes, and structured bindings' `get`.
+//!
+//! @details The compile-time index write goes through the `at` setter, the
+//! other paths write through the returned element reference. The vector paths
+//! visit a vector of as many elements as the square matrix.
+template <auto Size> void bench() {
+  uniform_matrix<Size, Size> m;
+  uniform_matrix<Size * Size, 1> v;
+
+  std::ofstream results{"results.txt", std::ios::app};
+  ankerl::nanobench::Bench bench;
+  bench.output(nullptr).performanceCounters(true).title("${BACKEND}");
+  measure(bench, "operator()", runtime<Size>, m,
+          [](auto &matrix, auto i, auto j) -> decltype(auto) {
+            return matrix(i, j);
+          });
+  measure(bench, "operator[]", runtime<Size>, m,
+          [](auto &matrix, auto i, auto j) -> decltype(auto) {
+            return matrix[i, j];
+          });
+  measure(bench, "literal", compile_time<Size>, m,
+          [](auto &matrix, auto i, auto j) -> decltype(auto) {
+            return matrix(i, j);
+          });
+  bench.run("at fill", [&]() {
+    compile_time<Size>([&](auto i, auto j) {
+      m.template at<i(), j()>(static_cast<double>(i + j));
+    });
+    ankerl::nanobench::doNotOptimizeAway(m);
+  });
+  bench.run("at read", [&]() {
+    compile_time<Size>([&](auto i, auto j) {
+      ankerl::nanobench::doNotOptimizeAway(m.template at<i(), j()>());
+    });
+  });
+  bench.run("at reduce", [&]() {
+    double sum{0.};
+    compile_time<Size>(
+        [&](auto i, auto j) { sum += m.template at<i(), j()>(); });
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  measure(bench, "vector operator()", runtime<Size>, v,
+          [](auto &vector, auto i, auto j) -> decltype(auto) {
+            return vector(i * Size + j);
+          });
+  measure(bench, "get", compile_time<Size>, v,
+          [](auto &vector, auto i, auto j) -> decltype(auto) {
+            return get<static_cast<int>(i * Size + j)>(vector);
+          });
+  bench.render(csv<Size>.c_str(), results);
+  record(bench, std::format("{}x{}", Size, Size));
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() { fcarouge::benchmark::bench<${SIZE}>(); }
@@ -0,0 +1,75 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Compile-time benchmark of the typed mp-units Eigen heterogeneous
+//! square matrix product.
+//!
+//! @details The translation unit is only compiled, its compilation is measured.
+//! The fixed size matrices are never allocated, lifting the Eigen stack
+//! allocation limit to compile the largest sizes.
+
+#define EIGEN_STACK_ALLOCATION_LIMIT 0
+
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace fcarouge::benchmark {
+namespace {
+//! @brief Kinematic state indexes of the given size, cycling through the
+//! position, velocity, and acceleration quantities.
+template <std::size_t Size>
+using kinematic = decltype([]<std::size_t... Indexes>(
+                               std::index_sequence<Indexes...>) {
+  return std::tuple<std::tuple_element_t<
+      Indexes % 3, std::tuple<position, velocity, acceleration>>...>{};
+}(std::make_index_sequence<Size>{}));
+
+//! @brief Inverse kinematic state indexes of the given size.
+template <std::size_t Size>
+using inverse_kinematic = decltype([]<std::size_t... Indexes>(
+                                       std::index_sequence<Indexes...>) {
+  return std::tuple<decltype(1. / std::tuple_element_t<
+                                      Indexes, kinematic<Size>>{})...>{};
+}(std::make_index_sequence<Size>{}));
+
+using covariance = matrix<double, kinematic<${SIZE}>, kinematic<${SIZE}>>;
+using transition =
+    matrix<double, kinematic<${SIZE}>, inverse_kinematic<${SIZE}>>;
+} // namespace
+
+//! @benchmark Instantiates the typed heterogeneous square matrix product,
+//! checking the multipliability of its elements.
+auto compile(const transition &f, const covariance &p) { return f * p; }
+} // namespace fcarouge::benchmark
@@ -0,0 +1,77 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Compile-time benchmark of the element types indexing through
+//! `std::tuple_element`.
+//!
+//! @details The translation unit is only compiled, its compilation is the
+//! reference of the `unit_eigen_type_list_compile` benchmark.
+
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace fcarouge::benchmark {
+namespace {
+//! @brief Kinematic state indexes of the given size, cycling through the
+//! position, velocity, and acceleration quantities.
+template <std::size_t Size>
+using kinematic = decltype([]<std::size_t... Indexes>(
+                               std::index_sequence<Indexes...>) {
+  return std::tuple<std::tuple_element_t<
+      Indexes % 3, std::tuple<position, velocity, acceleration>>...>{};
+}(std::make_index_sequence<Size>{}));
+
+using indexes = kinematic<${SIZE}>;
+
+//! @brief The index type at the given index, through `std::tuple_element`.
+template <std::size_t Index>
+using index_at = std::tuple_element_t<Index, indexes>;
+
+//! @brief The total size of the element types of the square matrix.
+template <std::size_t... Positions>
+constexpr std::size_t sizes(std::index_sequence<Positions...>) {
+  return (sizeof(typed_linear_algebra_internal::product<
+                 index_at<Positions / ${SIZE}>,
+                 index_at<Positions % ${SIZE}>>) +
+          ... + 0);
+}
+} // namespace
+
+//! @benchmark Indexes the row and column types of every element of the typed
+//! heterogeneous square matrix.
+std::size_t compile() {
+  return sizes(std::make_index_sequence<${SIZE} * ${SIZE}>{});
+}
+} // namespace fcarouge::benchmark
@@ -0,0 +1,50 @@
+#[[ Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> ]]
+
+# Explicitly instantiate the typed matrix operations listed in a header.
+#
+# * TARGET The target to add the instantiation translation unit to.
+# * HEADER The header listing the typed matrix operations with the macros of
+#   `fcarouge/typed_linear_algebra_extern.hpp`.
+#
+# The generated translation unit defines the
+# `FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTANTIATE` macro before including the header,
+# defining the listed operations once for the target. The other translation
+# units including the header only declare them.
+function(typed_linear_algebra_instantiate TARGET HEADER)
+  cmake_path(ABSOLUTE_PATH HEADER BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}"
+             NORMALIZE)
+  set(SOURCE "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_instantiation.cpp")
+  set(CONTENT "#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTANTIATE\n\n")
+  string(APPEND CONTENT "#include \"${HEADER}\"\n")
+  file(CONFIGURE OUTPUT "${SOURCE}" CONTENT "${CONTENT}" @ONLY)
+  target_sources(${TARGET} PRIVATE "${SOURCE}")
+endfunction(typed_linear_algebra_instantiate)
@@ -0,0 +1,83 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Typed linear algebra named module.
+//!
+//! @details Module interface unit of the library. The implementation headers
+//! are included in the global module fragment and their public declarations
+//! exported, the module is built once rather than parsed by every translation
+//! unit importing it.
+
+module;
+
+#include "fcarouge/typed_linear_algebra.hpp"
+
+export module fcarouge.typed_linear_algebra;
+
+export namespace fcarouge {
+using fcarouge::add;
+using fcarouge::cast;
+using fcarouge::column_typed_matrix;
+using fcarouge::element_caster;
+using fcarouge::get;
+using fcarouge::index;
+using fcarouge::magnitude;
+using fcarouge::make_typed_matrix;
+using fcarouge::matrix_product;
+using fcarouge::matrix_vector_product;
+using fcarouge::multipliable;
+using fcarouge::multiplies;
+using fcarouge::noalias;
+using fcarouge::noalias_typed_matrix;
+using fcarouge::operator==;
+using fcarouge::operator+;
+using fcarouge::operator-;
+using fcarouge::operator*;
+using fcarouge::operator/;
+using fcarouge::other;
+using fcarouge::other_tuple_like_vector;
+using fcarouge::rank_typed_matrix;
+using fcarouge::repeat;
+using fcarouge::row_typed_matrix;
+using fcarouge::same_as_typed_matrix;
+using fcarouge::same_shape;
+using fcarouge::scale;
+using fcarouge::transposed;
+using fcarouge::typed_column_vector;
+using fcarouge::typed_matrix;
+using fcarouge::typed_row_vector;
+using fcarouge::uniform_typed_matrix;
+
+namespace literals {
+using fcarouge::literals::operator""_i;
+} // namespace literals
+} // namespace fcarouge
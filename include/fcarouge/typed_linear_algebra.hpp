@@ -38,6 +38,7 @@ For more information, please refer to <https://unlicense.org> */
 //! @details Typed matrix, vectors, and operations.
 
 #include "typed_linear_algebra_forward.hpp"
+#include "typed_linear_algebra_internal/expression.hpp"
 #include "typed_linear_algebra_internal/utility.hpp"
 
 #include <concepts>
@@ -88,6 +89,13 @@ concept rank_typed_matrix = tla::rank_typed_matrix<Type, Rank>;
 template <typename Lhs, typename Rhs>
 concept same_shape = tla::same_shape<Lhs, Rhs>;
 
+//! @brief Concept of typed matrices that can be multiplied together.
+//!
+//! @details The matrices are of multipliable shapes and the per-term products
+//! of each row-column can be summed.
+template <typename Lhs, typename Rhs>
+concept multipliable = tla::multipliable<Lhs, Rhs>;
+
 //! @brief Concept of any type other than the typed matrix type.
 //!
 //! @details Practical for disambiguation.
@@ -140,11 +148,17 @@ concept index = tla::index<Type>;
 //! altogether?
 template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 class typed_matrix {
+  static_assert(tla::composable<Matrix, RowIndexes, ColumnIndexes>,
+                "The indexes must match the shape of the composed matrix.");
+
 public:
   //! @name Public Member Types
   //! @{
 
   //! @brief The type of the composed matrix.
+  //!
+  //! @details May be another typed matrix. The composition is flattened: see
+  //! `storage`.
   using matrix = Matrix;
 
   //! @brief The tuple with the row components of the indexes.
@@ -153,8 +167,17 @@ public:
   //! @brief The tuple with the column components of the indexes.
   using column_indexes = ColumnIndexes;
 
+  //! @brief The internal list of the row index types.
+  //!
+  //! @details Converted once from the row indexes tuple for the internal
+  //! lookups: see `type_list`.
+  using row_list = tla::type_list_t<row_indexes>;
+
+  //! @brief The internal list of the column index types.
+  using column_list = tla::type_list_t<column_indexes>;
+
   //! @brief The type of the element's underlying storage.
-  using underlying = tla::underlying_t<Matrix>;
+  using underlying = tla::underlying_t<tla::innermost_t<Matrix>>;
 
   //! @brief The type of the element at the given matrix indexes position.
   //!
@@ -170,10 +193,10 @@ public:
   //! @{
 
   //! @brief The count of rows.
-  static inline constexpr auto rows{std::tuple_size_v<row_indexes>};
+  static inline constexpr auto rows{row_list::size};
 
   //! @brief The count of rows.
-  static inline constexpr auto columns{std::tuple_size_v<column_indexes>};
+  static inline constexpr auto columns{column_list::size};
 
   //! @brief The number of dimensions in the matrix.
   static inline constexpr auto rank{tla::rank<rows, columns>};
@@ -209,6 +232,12 @@ public:
       typed_matrix(const same_as_typed_matrix auto &other);
 
   //! @brief Copy assign generalization of a compatible typed matrix.
+  //!
+  //! @details A typed matrix of lazily evaluated expression nodes, composed by
+  //! the operations of backends without native arithmetic expressions such as
+  //! `std::mdspan`, is evaluated into the storage of this typed matrix. As
+  //! with Eigen, an expression reading this typed matrix is evaluated into a
+  //! temporary first, see `noalias` otherwise.
   constexpr typed_matrix &operator=(const same_as_typed_matrix auto &other);
 
   //! @brief Move construct generalization of a compatible typed matrix.
@@ -217,8 +246,46 @@ public:
   constexpr explicit(false) typed_matrix(same_as_typed_matrix auto &&other);
 
   //! @brief Move assign generalization of a compatible typed matrix.
+  //!
+  //! @details Evaluates lazily evaluated expression nodes, see the copy
+  //! assignment generalization.
   constexpr typed_matrix &operator=(same_as_typed_matrix auto &&other);
 
+  //! @brief Add assign a typed matrix of the same shape.
+  //!
+  //! @details Each typed element sum must be assignable to the element of
+  //! this typed matrix. Updates the storage in place with the backend
+  //! compound assignment, or with `std::linalg::add` writing over the storage
+  //! for backends without arithmetic operators such as `std::mdspan`. Lazily
+  //! evaluated expression nodes are accumulated into the storage, through a
+  //! temporary if they read this typed matrix.
+  constexpr typed_matrix &operator+=(const same_as_typed_matrix auto &other);
+
+  //! @brief Substract assign a typed matrix of the same shape.
+  //!
+  //! @see operator+=
+  constexpr typed_matrix &operator-=(const same_as_typed_matrix auto &other);
+
+  //! @brief Multiply assign a typed matrix.
+  //!
+  //! @details The product must have the shape of this typed matrix, and each
+  //! typed element of the product must be assignable to the element of this
+  //! typed matrix. The product is evaluated into a temporary before it is
+  //! written over the storage.
+  constexpr typed_matrix &operator*=(const same_as_typed_matrix auto &other);
+
+  //! @brief Scale assign by a scalar.
+  //!
+  //! @details Each scaled typed element must be assignable to the element of
+  //! this typed matrix. Updates the storage in place with the backend
+  //! compound assignment, or with `std::linalg::scale`.
+  constexpr typed_matrix &operator*=(const other auto &value);
+
+  //! @brief Divide assign by a scalar.
+  //!
+  //! @see operator*=(const other auto &)
+  constexpr typed_matrix &operator/=(const other auto &value);
+
   //! @brief Convert construct a singleton typed matrix from a single value.
   //!
   //! @details Applicable to singleton matrix: one element.
@@ -413,7 +480,8 @@ public:
   //! access is needed. Not recommended for convenience access due to
   //! absence of type validation.
   //!
-  //! @return A reference to the underlying element storage.
+  //! @return A reference to the underlying element storage, the innermost
+  //! backend matrix for typed matrix compositions.
   [[nodiscard]] constexpr decltype(auto) data(this auto &&self);
 
   //! @}
@@ -423,7 +491,10 @@ private:
   //! @{
 
   //! @brief Underlying algebraic backend data storage.
-  Matrix storage;
+  //!
+  //! @details The innermost backend of a typed matrix composition, with the
+  //! outermost index description merged over the composed ones.
+  tla::innermost_t<Matrix> storage;
 
   //! @}
 };
@@ -438,6 +509,88 @@ template <typename Matrix, typename... RowIndexes>
 using typed_column_vector =
     typed_matrix<Matrix, std::tuple<RowIndexes...>, tla::identity_index>;
 
+//! @brief Typed matrix destination assigned without aliasing guard.
+//!
+//! @details Obtained from `noalias`. The assigned typed matrices are checked
+//! against the index types of the destination, as for the typed matrix
+//! assignments, and written directly into the storage of the destination.
+//! The backend does not evaluate the products into a temporary first, as with
+//! Eigen `noalias()`.
+//!
+//! @tparam TypedMatrix The type of the destination typed matrix.
+//!
+//! @warning The assigned operands must not alias the destination.
+template <typename TypedMatrix> class noalias_typed_matrix {
+public:
+  //! @brief Construct the assignment proxy of the destination.
+  constexpr explicit noalias_typed_matrix(TypedMatrix &destination);
+
+  //! @brief Assign a compatible typed matrix into the destination.
+  constexpr noalias_typed_matrix &
+  operator=(const same_as_typed_matrix auto &other);
+
+  //! @brief Add assign a compatible typed matrix into the destination.
+  constexpr noalias_typed_matrix &
+  operator+=(const same_as_typed_matrix auto &other);
+
+  //! @brief Substract assign a compatible typed matrix into the destination.
+  constexpr noalias_typed_matrix &
+  operator-=(const same_as_typed_matrix auto &other);
+
+private:
+  //! @brief The destination typed matrix.
+  TypedMatrix &destination;
+};
+
+//! @brief Run-length index descriptor.
+//!
+//! @details Stands for `Count` consecutive indexes of the `Type` index type
+//! among the row or column index types of a typed matrix. For example, the
+//! `std::tuple<repeat<position, 64>, repeat<velocity, 64>>` row indexes
+//! describe 64 position rows followed by 64 velocity rows. The elements types,
+//! the products, and the transposes are computed on the runs rather than on
+//! the expanded indexes, at a compile cost scaling with the count of runs.
+//! Index types of different runs, for example `std::tuple<repeat<m, 2>, s>`
+//! and `std::tuple<m, m, s>`, combine over their expanded indexes.
+template <typename Type, std::size_t Count> struct repeat {};
+
+//! @name Run-Length Index Descriptor Operators
+//! @{
+
+//! @brief Index type computations over runs, declared only for the `multiplies`
+//! and `divides` type specialization points.
+//!
+//! @details Two runs combine index by index only with the same count: a
+//! combination of runs of different counts is rejected at compile time.
+template <typename Type, std::size_t Count, typename Rhs>
+  requires(not tla::is_repeat<Rhs>)
+auto operator*(const repeat<Type, Count> &lhs, const Rhs &rhs)
+    -> repeat<tla::product<Type, Rhs>, Count>;
+template <typename Lhs, typename Type, std::size_t Count>
+  requires(not tla::is_repeat<Lhs>)
+auto operator*(const Lhs &lhs, const repeat<Type, Count> &rhs)
+    -> repeat<tla::product<Lhs, Type>, Count>;
+template <typename Type1, std::size_t Count1, typename Type2,
+          std::size_t Count2>
+auto operator*(const repeat<Type1, Count1> &lhs,
+               const repeat<Type2, Count2> &rhs)
+    -> tla::paired_run_t<tla::product<Type1, Type2>, Count1, Count2>;
+template <typename Type, std::size_t Count, typename Rhs>
+  requires(not tla::is_repeat<Rhs>)
+auto operator/(const repeat<Type, Count> &lhs, const Rhs &rhs)
+    -> repeat<tla::quotient<Type, Rhs>, Count>;
+template <typename Lhs, typename Type, std::size_t Count>
+  requires(not tla::is_repeat<Lhs>)
+auto operator/(const Lhs &lhs, const repeat<Type, Count> &rhs)
+    -> repeat<tla::quotient<Lhs, Type>, Count>;
+template <typename Type1, std::size_t Count1, typename Type2,
+          std::size_t Count2>
+auto operator/(const repeat<Type1, Count1> &lhs,
+               const repeat<Type2, Count2> &rhs)
+    -> tla::paired_run_t<tla::quotient<Type1, Type2>, Count1, Count2>;
+
+//! @}
+
 //! @brief Typed matrix element conversions customization point.
 //!
 //! @details Specialize this template to allow conversion of element's type and
@@ -479,6 +632,14 @@ using typed_linear_algebra_internal::multiplies;
 template <typename RowIndexes, typename ColumnIndexes>
 [[nodiscard]] constexpr auto make_typed_matrix(auto &&value);
 
+//! @brief Assign the destination without aliasing guard.
+//!
+//! @details For example `noalias(r) = a * b` writes the product directly into
+//! the storage of `r`, without a temporary.
+//!
+//! @see noalias_typed_matrix
+[[nodiscard]] constexpr auto noalias(same_as_typed_matrix auto &destination);
+
 //! @brief Get function argument-dependent lookup overload.
 //!
 //! @details Also provides support for structured bindings.
@@ -588,8 +749,6 @@ namespace fcarouge {
 
 [[nodiscard]] constexpr auto transposed(const same_as_typed_matrix auto &value);
 
-#ifdef __cpp_lib_linalg
-
 constexpr void add(const rank_typed_matrix<2> auto &lhs,
                    const rank_typed_matrix<2> auto &rhs,
                    same_as_typed_matrix auto &result);
@@ -603,15 +762,21 @@ constexpr void add(const rank_typed_matrix<0> auto &lhs,
 constexpr void matrix_product(const same_as_typed_matrix auto &lhs,
                               const same_as_typed_matrix auto &rhs,
                               same_as_typed_matrix auto &result);
+constexpr void matrix_product(const same_as_typed_matrix auto &lhs,
+                              const same_as_typed_matrix auto &rhs,
+                              const same_as_typed_matrix auto &update,
+                              same_as_typed_matrix auto &result);
 
 constexpr void matrix_vector_product(const rank_typed_matrix<2> auto &lhs,
                                      const rank_typed_matrix<1> auto &rhs,
                                      rank_typed_matrix<1> auto &result);
+constexpr void matrix_vector_product(const rank_typed_matrix<2> auto &lhs,
+                                     const rank_typed_matrix<1> auto &rhs,
+                                     const rank_typed_matrix<1> auto &update,
+                                     rank_typed_matrix<1> auto &result);
 
 constexpr void scale(const auto &α, same_as_typed_matrix auto &x);
 
-#endif
-
 //! @}
 
 } // namespace fcarouge
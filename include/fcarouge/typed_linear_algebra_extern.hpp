@@ -0,0 +1,147 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_EXTERN_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_EXTERN_HPP
+
+//! @file
+//! @brief Explicit instantiation of typed matrix operations.
+//!
+//! @details List the operations of the common typed matrix types of a project
+//! in one header with the macros below. Every translation unit including the
+//! header declares the listed operations as external, non-template functions.
+//! Overload resolution prefers them to the operator templates, whose bodies,
+//! result expressions, and backend products are then not instantiated. The
+//! one translation unit defining `FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTANTIATE`
+//! before including the header defines them, see the
+//! `typed_linear_algebra_instantiate` CMake helper. The operations evaluate
+//! their results into the given result type rather than returning the
+//! backend's lazy expressions. The defining translation unit asserts the
+//! result type has the index types of the operator template's result.
+//!
+//! The evaluated results are not fused: in the translation units including
+//! the header, `a * b + c` of listed operations evaluates the product into a
+//! temporary result, then the sum, where the operator templates build a
+//! single lazy Eigen expression assigned in one pass. List only the operations
+//! whose compilation time matters more than their fusion.
+//!
+//! The macros are listed at global namespace scope, their arguments are fully
+//! qualified type aliases, without commas:
+//!
+//! @code
+//! namespace project {
+//! using state = fcarouge::column_vector<double, 6>;
+//! using covariance = fcarouge::matrix<double, 6, 6>;
+//! } // namespace project
+//!
+//! FCAROUGE_TYPED_LINEAR_ALGEBRA_PRODUCT(project::covariance,
+//!                                       project::covariance,
+//!                                       project::covariance)
+//! FCAROUGE_TYPED_LINEAR_ALGEBRA_PRODUCT(project::state, project::covariance,
+//!                                       project::state)
+//! FCAROUGE_TYPED_LINEAR_ALGEBRA_SUM(project::covariance, project::covariance,
+//!                                   project::covariance)
+//! FCAROUGE_TYPED_LINEAR_ALGEBRA_FORMAT(project::covariance)
+//! @endcode
+
+#include "typed_linear_algebra.hpp"
+
+#include <concepts>
+#include <format>
+#include <type_traits>
+
+//! @brief Declares a binary typed matrix operator as an external function.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_DECLARE(Operator, Result, Lhs, Rhs)      \
+  namespace fcarouge {                                                         \
+  [[nodiscard]] Result operator Operator(const Lhs &lhs, const Rhs &rhs);      \
+  }
+
+//! @brief Declares the typed matrix formatter as explicitly instantiated.
+//!
+//! @details The formatter is `constexpr`, optimizing compilers may still
+//! instantiate it for inlining.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_DECLARE_FORMAT(Type)                     \
+  extern template std::format_context::iterator                                \
+  std::formatter<Type, char>::format<std::format_context>(                     \
+      const Type &value, std::format_context &format_context) const;
+
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTANTIATE
+
+//! @brief Defines a binary typed matrix operator from its operator template.
+//!
+//! @details The empty template argument list restricts the call to the
+//! operator templates. The given result type must have the row and column
+//! index types of the operator template's result: a mismatched result type
+//! would otherwise silently convert, or fail deep in the backend.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_DEFINE(Operator, Result, Lhs, Rhs)       \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DECLARE(Operator, Result, Lhs, Rhs)            \
+  Result fcarouge::operator Operator(const Lhs &lhs, const Rhs &rhs) {         \
+    using expected = std::remove_cvref_t<                                      \
+        decltype(fcarouge::operator Operator<>(lhs, rhs))>;                    \
+    static_assert(                                                             \
+        std::same_as<typename Result::row_indexes,                             \
+                     typename expected::row_indexes> and                       \
+            std::same_as<typename Result::column_indexes,                      \
+                         typename expected::column_indexes>,                   \
+        "The explicitly instantiated operation requires a result type of the " \
+        "index types of the operator template's result.");                     \
+    return fcarouge::operator Operator<>(lhs, rhs);                            \
+  }
+
+//! @brief Explicitly instantiates the typed matrix formatter.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_FORMAT(Type)                             \
+  template std::format_context::iterator                                       \
+  std::formatter<Type, char>::format<std::format_context>(                     \
+      const Type &value, std::format_context &format_context) const;
+
+#else
+
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_DEFINE(Operator, Result, Lhs, Rhs)       \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DECLARE(Operator, Result, Lhs, Rhs)
+
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_FORMAT(Type)                             \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DECLARE_FORMAT(Type)
+
+#endif
+
+//! @brief Typed matrix product `Result = Lhs * Rhs` external function.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_PRODUCT(Result, Lhs, Rhs)                \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DEFINE(*, Result, Lhs, Rhs)
+
+//! @brief Typed matrix sum `Result = Lhs + Rhs` external function.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_SUM(Result, Lhs, Rhs)                    \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DEFINE(+, Result, Lhs, Rhs)
+
+//! @brief Typed matrix difference `Result = Lhs - Rhs` external function.
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_DIFFERENCE(Result, Lhs, Rhs)             \
+  FCAROUGE_TYPED_LINEAR_ALGEBRA_DEFINE(-, Result, Lhs, Rhs)
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_EXTERN_HPP
@@ -38,7 +38,10 @@ For more information, please refer to <https://unlicense.org> */
 //! @details Use this authoritative header to forward declare the types of this
 //! project and avoid inconsistent declarations.
 
+#include <cstddef>
+
 namespace fcarouge {
+template <typename Type, std::size_t Count> struct repeat;
 template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 class typed_matrix;
 template <typename To, typename From> struct element_caster;
@@ -32,12 +32,6 @@ For more information, please refer to <https://unlicense.org> */
 #ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_ADD_TPP
 #define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_ADD_TPP
 
-#ifdef __cpp_lib_linalg
-
-#include <linalg>
-
-#endif
-
 namespace fcarouge {
 [[nodiscard]] constexpr auto operator+(const rank_typed_matrix<2> auto &lhs,
                                        const rank_typed_matrix<2> auto &rhs) {
@@ -49,23 +43,15 @@ namespace fcarouge {
 
   // Each typed element of the lhs matrix must be addable to the corresponding
   // typed element of the rhs matrix.
-  tla::for_constexpr<lhs_matrix::rows>([&](auto i) {
-    tla::for_constexpr<lhs_matrix::columns>([&](auto j) {
-      using lhs_element = typename lhs_matrix::template element<i, j>;
-      using rhs_element = typename rhs_matrix::template element<i, j>;
-
-      static_assert(
-          requires {
-            std::declval<lhs_element>() + std::declval<rhs_element>();
-          }, "Matrix addition requires compatible element types.");
-    });
-  });
+  static_assert(
+      tla::elementwise_compatible<tla::addable, lhs_matrix, rhs_matrix>(),
+      "Matrix addition requires compatible element types.");
 
   using row_indexes = typename lhs_matrix::row_indexes;
   using column_indexes = typename lhs_matrix::column_indexes;
 
-  return make_typed_matrix<row_indexes, column_indexes>(lhs.data() +
-                                                        rhs.data());
+  return make_typed_matrix<row_indexes, column_indexes>(
+      tla::plus(lhs.data(), rhs.data()));
 }
 
 [[nodiscard]] constexpr auto operator+(const rank_typed_matrix<1> auto &lhs,
@@ -78,20 +64,15 @@ namespace fcarouge {
 
   // Each typed element of the lhs matrix must be addable to the corresponding
   // typed element of the rhs matrix.
-  tla::for_constexpr<lhs_matrix::rows * lhs_matrix::columns>([&](auto i) {
-    using lhs_element = typename lhs_matrix::template element<i>;
-    using rhs_element = typename rhs_matrix::template element<i>;
-
-    static_assert(
-        requires { std::declval<lhs_element>() + std::declval<rhs_element>(); },
-        "Matrix addition requires compatible element types.");
-  });
+  static_assert(
+      tla::elementwise_compatible<tla::addable, lhs_matrix, rhs_matrix>(),
+      "Matrix addition requires compatible element types.");
 
   using row_indexes = typename lhs_matrix::row_indexes;
   using column_indexes = typename lhs_matrix::column_indexes;
 
-  return make_typed_matrix<row_indexes, column_indexes>(lhs.data() +
-                                                        rhs.data());
+  return make_typed_matrix<row_indexes, column_indexes>(
+      tla::plus(lhs.data(), rhs.data()));
 }
 
 [[nodiscard]] constexpr auto operator+(const rank_typed_matrix<0> auto &lhs,
@@ -128,10 +109,12 @@ namespace fcarouge {
   return element{lhs} + rhs;
 }
 
-#ifdef __cpp_lib_linalg
-
 //! @brief Element-wise addition of two typed matrices.
 //!
+//! @details The sum is written directly into the result storage, without
+//! temporary nor allocation: assigned with Eigen `noalias()` or computed by
+//! `std::linalg::add`.
+//!
 //! @see std::linalg::add
 constexpr void add(const rank_typed_matrix<2> auto &lhs,
                    const rank_typed_matrix<2> auto &rhs,
@@ -146,22 +129,11 @@ constexpr void add(const rank_typed_matrix<2> auto &lhs,
   // Each typed element of the lhs matrix must be addable to the corresponding
   // typed element of the rhs matrix and assignable to the corresponding typed
   // element of the result matrix.
-  tla::for_constexpr<lhs_matrix::rows>([&](auto i) {
-    tla::for_constexpr<lhs_matrix::columns>([&](auto j) {
-      using lhs_element = typename lhs_matrix::template element<i, j>;
-      using rhs_element = typename rhs_matrix::template element<i, j>;
-      using result_element = typename result_matrix::template element<i, j>;
-
-      static_assert(
-          requires {
-            std::declval<result_element>() =
-                std::declval<lhs_element>() + std::declval<rhs_element>();
-          }, "Matrix addition requires compatible element types.");
-    });
-  });
-
-  using std::linalg::add;
-  add(lhs.data(), rhs.data(), result.data());
+  static_assert(tla::elementwise_compatible<tla::addable_to, result_matrix,
+                                            lhs_matrix, rhs_matrix>(),
+                "Matrix addition requires compatible element types.");
+
+  tla::add_into(lhs.data(), rhs.data(), result.data());
 }
 
 constexpr void add(const rank_typed_matrix<1> auto &lhs,
@@ -177,20 +149,11 @@ constexpr void add(const rank_typed_matrix<1> auto &lhs,
   // Each typed element of the lhs matrix must be addable to the corresponding
   // typed element of the rhs matrix and assignable to the corresponding typed
   // element of the result matrix.
-  tla::for_constexpr<lhs_matrix::rows * lhs_matrix::columns>([&](auto i) {
-    using lhs_element = typename lhs_matrix::template element<i>;
-    using rhs_element = typename rhs_matrix::template element<i>;
-    using result_element = typename result_matrix::template element<i>;
-
-    static_assert(
-        requires {
-          std::declval<result_element>() =
-              std::declval<lhs_element>() + std::declval<rhs_element>();
-        }, "Matrix addition requires compatible element types.");
-  });
-
-  using std::linalg::add;
-  add(lhs.data(), rhs.data(), result.data());
+  static_assert(tla::elementwise_compatible<tla::addable_to, result_matrix,
+                                            lhs_matrix, rhs_matrix>(),
+                "Matrix addition requires compatible element types.");
+
+  tla::add_into(lhs.data(), rhs.data(), result.data());
 }
 
 constexpr void add(const rank_typed_matrix<0> auto &lhs,
@@ -213,12 +176,8 @@ constexpr void add(const rank_typed_matrix<0> auto &lhs,
             std::declval<lhs_element>() + std::declval<rhs_element>();
       }, "Matrix addition requires compatible element types.");
 
-  using std::linalg::add;
-  add(lhs.data(), rhs.data(), result.data());
+  tla::add_into(lhs.data(), rhs.data(), result.data());
 }
-
-#endif
-
 } // namespace fcarouge
 
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_ADD_TPP
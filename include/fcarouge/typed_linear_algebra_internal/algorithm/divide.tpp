@@ -55,14 +55,12 @@ namespace tla = typed_linear_algebra_internal;
                 "Matrix division requires compatible sizes.");
 
   using lhs_row_indexes = typename lhs_matrix::row_indexes;
-  using lhs_column_indexes = typename lhs_matrix::column_indexes;
   using rhs_row_indexes = typename rhs_matrix::row_indexes;
-  using rhs_column_indexes = typename rhs_matrix::column_indexes;
   using row_indexes =
       tla::quotient<lhs_row_indexes,
-                    std::tuple_element_t<0, lhs_column_indexes>>;
+                    typename lhs_matrix::column_list::template at<0>>;
   using column_indexes =
-      tla::quotient<std::tuple_element_t<0, rhs_column_indexes>,
+      tla::quotient<typename rhs_matrix::column_list::template at<0>,
                     rhs_row_indexes>;
 
   //! @todo Add type verification, perhaps with a generalization of the
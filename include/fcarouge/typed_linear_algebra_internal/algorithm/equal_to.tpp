@@ -56,18 +56,14 @@ namespace fcarouge {
   static_assert(same_shape<lhs_matrix, rhs_matrix>,
                 "Matrix equality requires matrices of the same shapes, sizes.");
 
+  static_assert(
+      tla::elementwise_compatible<tla::comparable, lhs_matrix, rhs_matrix>(),
+      "Matrix equality requires comparable element types.");
+
   bool result{true};
 
   tla::for_constexpr<lhs_matrix::rows>([&](auto i) {
     tla::for_constexpr<lhs_matrix::columns>([&](auto j) {
-      using lhs_element = typename lhs_matrix::template element<i, j>;
-      using rhs_element = typename rhs_matrix::template element<i, j>;
-
-      static_assert(
-          requires {
-            std::declval<lhs_element>() == std::declval<rhs_element>();
-          }, "Matrix equality requires comparable element types.");
-
       result &= (lhs.template at<i, j>() == rhs.template at<i, j>());
     });
   });
@@ -87,17 +83,13 @@ namespace fcarouge {
   static_assert(same_shape<lhs_matrix, rhs_matrix>,
                 "Matrix equality requires matrices of the same shapes, sizes.");
 
+  static_assert(
+      tla::elementwise_compatible<tla::comparable, lhs_matrix, rhs_matrix>(),
+      "Matrix equality requires comparable element types.");
+
   bool result{true};
 
   tla::for_constexpr<lhs_matrix::rows * lhs_matrix::columns>([&](auto i) {
-    using lhs_element = typename lhs_matrix::template element<i>;
-    using rhs_element = typename rhs_matrix::template element<i>;
-
-    static_assert(
-        requires {
-          std::declval<lhs_element>() == std::declval<rhs_element>();
-        }, "Matrix equality requires comparable element types.");
-
     result &= (lhs.template at<i>() == rhs.template at<i>());
   });
 
@@ -32,25 +32,71 @@ For more information, please refer to <https://unlicense.org> */
 #ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_PRODUCT_TPP
 #define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_PRODUCT_TPP
 
-//! @todo Remove the feature check when supporting native C++26.
-#ifdef __cpp_lib_linalg
-
-#include <linalg>
-
 namespace fcarouge {
 
-//! @brief
+//! @brief Computes the product of two matrices.
+//!
+//! @details The product is written directly into the result storage, without
+//! temporary nor allocation: assigned with Eigen `noalias()` or computed by
+//! `std::linalg::matrix_product`. The result must not alias the operands.
 //!
 //! @see std::linalg::matrix_product
+constexpr void matrix_product(const same_as_typed_matrix auto &lhs,
+                              const same_as_typed_matrix auto &rhs,
+                              same_as_typed_matrix auto &result) {
+  using lhs_matrix = std::remove_cvref_t<decltype(lhs)>;
+  using rhs_matrix = std::remove_cvref_t<decltype(rhs)>;
+  using result_matrix = std::remove_cvref_t<decltype(result)>;
+
+  static_assert(multipliable<lhs_matrix, rhs_matrix>,
+                "Matrix product requires multipliable matrices.");
+
+  // Each typed element of the product must be assignable to the corresponding
+  // typed element of the result matrix.
+  static_assert(
+      tla::elementwise_compatible<
+          tla::assignable, result_matrix,
+          tla::product_indexes<lhs_matrix, rhs_matrix>>(),
+      "Matrix product requires compatible element types.");
+
+  tla::matrix_product_into(lhs.data(), rhs.data(), result.data());
+}
+
+//! @brief Computes the sum of a matrix and of the product of two matrices.
 //!
-//! @todo Requires, assert that the element types are compatible.
+//! @details Updating overload: `result = update + lhs * rhs`, in a single
+//! pass over the result storage. The result may be the update matrix. The
+//! update element types must be addable to the product element types, and
+//! their sums assignable to the result element types.
+//!
+//! @see std::linalg::matrix_product
 constexpr void matrix_product(const same_as_typed_matrix auto &lhs,
                               const same_as_typed_matrix auto &rhs,
+                              const same_as_typed_matrix auto &update,
                               same_as_typed_matrix auto &result) {
-  using std::linalg::matrix_product;
-  matrix_product(lhs.data(), rhs.data(), result.data());
+  using lhs_matrix = std::remove_cvref_t<decltype(lhs)>;
+  using rhs_matrix = std::remove_cvref_t<decltype(rhs)>;
+  using update_matrix = std::remove_cvref_t<decltype(update)>;
+  using result_matrix = std::remove_cvref_t<decltype(result)>;
+
+  static_assert(multipliable<lhs_matrix, rhs_matrix>,
+                "Matrix product requires multipliable matrices.");
+
+  static_assert(same_shape<update_matrix, result_matrix>,
+                "Updating matrix product requires update and result "
+                "matrices of the same shapes, sizes.");
+
+  // Each typed element of the update must be addable to the corresponding
+  // typed element of the product, and their sum assignable to the
+  // corresponding typed element of the result matrix.
+  static_assert(tla::elementwise_compatible<
+                    tla::addable_to, result_matrix, update_matrix,
+                    tla::product_indexes<lhs_matrix, rhs_matrix>>(),
+                "Updating matrix product requires compatible element types.");
+
+  tla::matrix_product_into(lhs.data(), rhs.data(), update.data(),
+                           result.data());
 }
 } // namespace fcarouge
 
-#endif
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_PRODUCT_TPP
@@ -32,44 +32,74 @@ For more information, please refer to <https://unlicense.org> */
 #ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_VECTOR_PRODUCT_TPP
 #define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_VECTOR_PRODUCT_TPP
 
-//! @todo Remove the feature check when supporting native C++26.
-#ifdef __cpp_lib_linalg
-
-#include <cstddef>
-#include <linalg>
-#include <mdspan>
-
 namespace fcarouge {
 
-//! @brief Reinterprets a row or column typed vector's contiguous, rank two,
-//! n-by-one or one-by-n storage as the rank one span required by
-//! `std::linalg`'s vector concepts.
+//! @brief Computes the product of a matrix and a vector.
 //!
-//! @details A typed row or column vector, `rank_typed_matrix<1>`, is stored
-//! as a rank two, n-by-one or one-by-n, underlying matrix, unlike the rank
-//! one `in-vector`, `out-vector` shapes expected by `std::linalg`.
-template <typename Type> constexpr auto as_vector_span(Type &value) {
-  using matrix = std::remove_cvref_t<Type>;
-  using underlying = typename matrix::underlying;
-
-  return std::mdspan<underlying,
-                     std::extents<std::size_t, matrix::rows * matrix::columns>>(
-      value.data().data_handle());
+//! @details The row or column vectors are viewed as column vectors. The
+//! product is written directly into the result storage, without temporary nor
+//! allocation: assigned with Eigen `noalias()` or computed by
+//! `std::linalg::matrix_vector_product`. The result must not alias the
+//! operands.
+//!
+//! @see std::linalg::matrix_vector_product
+constexpr void matrix_vector_product(const rank_typed_matrix<2> auto &lhs,
+                                     const rank_typed_matrix<1> auto &rhs,
+                                     rank_typed_matrix<1> auto &result) {
+  using lhs_matrix = std::remove_cvref_t<decltype(lhs)>;
+  using rhs_matrix = tla::column_view_t<decltype(rhs)>;
+  using result_matrix = tla::column_view_t<decltype(result)>;
+
+  static_assert(multipliable<lhs_matrix, rhs_matrix>,
+                "Matrix vector product requires multipliable matrices.");
+
+  // Each typed element of the product must be assignable to the corresponding
+  // typed element of the result vector.
+  static_assert(
+      tla::elementwise_compatible<
+          tla::assignable, result_matrix,
+          tla::product_indexes<lhs_matrix, rhs_matrix>>(),
+      "Matrix vector product requires compatible element types.");
+
+  tla::matrix_vector_product_into(lhs.data(), rhs.data(), result.data());
 }
 
-//! @brief Computes the product of a matrix and a vector.
+//! @brief Computes the sum of a vector and of the product of a matrix and a
+//! vector.
 //!
-//! @see std::linalg::matrix_vector_product
+//! @details Updating overload: `result = update + lhs * rhs`, in a single
+//! pass over the result storage. The result may be the update vector.
 //!
-//! @todo Requires, assert that the element types are compatible.
+//! @see matrix_product
+//! @see std::linalg::matrix_vector_product
 constexpr void matrix_vector_product(const rank_typed_matrix<2> auto &lhs,
                                      const rank_typed_matrix<1> auto &rhs,
+                                     const rank_typed_matrix<1> auto &update,
                                      rank_typed_matrix<1> auto &result) {
-  using std::linalg::matrix_vector_product;
-  matrix_vector_product(lhs.data(), as_vector_span(rhs),
-                        as_vector_span(result));
+  using lhs_matrix = std::remove_cvref_t<decltype(lhs)>;
+  using rhs_matrix = tla::column_view_t<decltype(rhs)>;
+  using update_matrix = tla::column_view_t<decltype(update)>;
+  using result_matrix = tla::column_view_t<decltype(result)>;
+
+  static_assert(multipliable<lhs_matrix, rhs_matrix>,
+                "Matrix vector product requires multipliable matrices.");
+
+  static_assert(same_shape<update_matrix, result_matrix>,
+                "Updating matrix vector product requires update and result "
+                "vectors of the same shapes, sizes.");
+
+  // Each typed element of the update must be addable to the corresponding
+  // typed element of the product, and their sum assignable to the
+  // corresponding typed element of the result vector.
+  static_assert(
+      tla::elementwise_compatible<
+          tla::addable_to, result_matrix, update_matrix,
+          tla::product_indexes<lhs_matrix, rhs_matrix>>(),
+      "Updating matrix vector product requires compatible element types.");
+
+  tla::matrix_vector_product_into(lhs.data(), rhs.data(), update.data(),
+                                  result.data());
 }
 } // namespace fcarouge
 
-#endif
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_MATRIX_VECTOR_PRODUCT_TPP
@@ -37,15 +37,8 @@ namespace fcarouge {
   using matrix = std::remove_cvref_t<decltype(value)>;
 
   // Each typed element of the matrix must be negatable.
-  tla::for_constexpr<matrix::rows>([&](auto i) {
-    tla::for_constexpr<matrix::columns>([&](auto j) {
-      using element = typename matrix::template element<i, j>;
-
-      static_assert(
-          requires { -std::declval<element>(); },
-          "Matrix negation requires negatable element types.");
-    });
-  });
+  static_assert(tla::elementwise_compatible<tla::negatable, matrix>(),
+                "Matrix negation requires negatable element types.");
 
   using row_indexes = typename matrix::row_indexes;
   using column_indexes = typename matrix::column_indexes;
@@ -57,13 +50,8 @@ namespace fcarouge {
   using matrix = std::remove_cvref_t<decltype(value)>;
 
   // Each typed element of the matrix must be negatable.
-  tla::for_constexpr<matrix::rows * matrix::columns>([&](auto i) {
-    using element = typename matrix::template element<i>;
-
-    static_assert(
-        requires { -std::declval<element>(); },
-        "Matrix negation requires negatable element types.");
-  });
+  static_assert(tla::elementwise_compatible<tla::negatable, matrix>(),
+                "Matrix negation requires negatable element types.");
 
   using row_indexes = typename matrix::row_indexes;
   using column_indexes = typename matrix::column_indexes;
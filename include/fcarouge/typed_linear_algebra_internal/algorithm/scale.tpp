@@ -32,23 +32,19 @@ For more information, please refer to <https://unlicense.org> */
 #ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_SCALE_TPP
 #define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_SCALE_TPP
 
-//! @todo Remove the feature check when supporting native C++26.
-#ifdef __cpp_lib_linalg
-
-#include <linalg>
-
 //! @todo Reflect over the std::linalg algorithms to provide the typed bindings?
 
 namespace fcarouge {
 
 //! @brief Multiply the elements of an object in place by a scalar.
 //!
+//! @details The backend compound assignment, such as Eigen `*=`, or
+//! `std::linalg::scale`.
+//!
 //! @see std::linalg::scale
 constexpr void scale(const auto &α, same_as_typed_matrix auto &x) {
-  using std::linalg::scale;
-  scale(α, x.data());
+  tla::times_assign(x.data(), α);
 }
 } // namespace fcarouge
 
-#endif
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALGORITHM_SCALE_TPP
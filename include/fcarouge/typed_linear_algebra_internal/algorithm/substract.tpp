@@ -34,7 +34,6 @@ For more information, please refer to <https://unlicense.org> */
 
 namespace fcarouge {
 
-//! @todo Requires, assert that the element types are compatible.
 [[nodiscard]] constexpr auto operator-(const rank_typed_matrix<2> auto &lhs,
                                        const rank_typed_matrix<2> auto &rhs) {
   using lhs_matrix = std::remove_cvref_t<decltype(lhs)>;
@@ -46,23 +45,15 @@ namespace fcarouge {
 
   // Each typed element of the lhs matrix must be substractable to the
   // corresponding typed element of the rhs matrix.
-  tla::for_constexpr<lhs_matrix::rows>([&](auto i) {
-    tla::for_constexpr<lhs_matrix::columns>([&](auto j) {
-      using lhs_element = typename lhs_matrix::template element<i, j>;
-      using rhs_element = typename rhs_matrix::template element<i, j>;
-
-      static_assert(
-          requires {
-            std::declval<lhs_element>() - std::declval<rhs_element>();
-          }, "Matrix subtraction requires compatible element types.");
-    });
-  });
+  static_assert(tla::elementwise_compatible<tla::substractable, lhs_matrix,
+                                            rhs_matrix>(),
+                "Matrix subtraction requires compatible element types.");
 
   using row_indexes = typename lhs_matrix::row_indexes;
   using column_indexes = typename lhs_matrix::column_indexes;
 
-  return make_typed_matrix<row_indexes, column_indexes>(lhs.data() -
-                                                        rhs.data());
+  return make_typed_matrix<row_indexes, column_indexes>(
+      tla::minus(lhs.data(), rhs.data()));
 }
 
 [[nodiscard]] constexpr auto operator-(const rank_typed_matrix<1> auto &lhs,
@@ -76,20 +67,15 @@ namespace fcarouge {
 
   // Each typed element of the lhs matrix must be substractable to the
   // corresponding typed element of the rhs matrix.
-  tla::for_constexpr<lhs_matrix::rows * lhs_matrix::columns>([&](auto i) {
-    using lhs_element = typename lhs_matrix::template element<i>;
-    using rhs_element = typename rhs_matrix::template element<i>;
-
-    static_assert(
-        requires { std::declval<lhs_element>() - std::declval<rhs_element>(); },
-        "Matrix subtraction requires compatible element types.");
-  });
+  static_assert(tla::elementwise_compatible<tla::substractable, lhs_matrix,
+                                            rhs_matrix>(),
+                "Matrix subtraction requires compatible element types.");
 
   using row_indexes = typename lhs_matrix::row_indexes;
   using column_indexes = typename lhs_matrix::column_indexes;
 
-  return make_typed_matrix<row_indexes, column_indexes>(lhs.data() -
-                                                        rhs.data());
+  return make_typed_matrix<row_indexes, column_indexes>(
+      tla::minus(lhs.data(), rhs.data()));
 }
 
 [[nodiscard]] constexpr auto operator-(const rank_typed_matrix<0> auto &lhs,
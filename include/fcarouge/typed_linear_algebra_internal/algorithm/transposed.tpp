@@ -49,7 +49,6 @@ transposed(const same_as_typed_matrix auto &value) {
 
   //! @todo Add other common transpose interfaces.
   //! @todo Add transpose customization point object.
-  //! @todo Support nested typed matrices.
   if constexpr (requires { value.data().transpose(); }) {
     return make_typed_matrix<transposed_row_indexes, transposed_column_indexes>(
         value.data().transpose());
@@ -57,6 +56,12 @@ transposed(const same_as_typed_matrix auto &value) {
 
 #ifdef __cpp_lib_linalg
 
+  else if constexpr (tla::is_expression<decltype(value.data())>) {
+    using expression = std::remove_cvref_t<decltype(value.data())>;
+    return make_typed_matrix<transposed_row_indexes, transposed_column_indexes>(
+        tla::transposed_expression<expression>{value.data()});
+  }
+
   else {
     using std::linalg::transposed;
     return make_typed_matrix<transposed_row_indexes, transposed_column_indexes>(
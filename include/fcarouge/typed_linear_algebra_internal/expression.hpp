@@ -0,0 +1,599 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPRESSION_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPRESSION_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#ifdef __cpp_lib_linalg
+
+#include <linalg>
+#include <mdspan>
+
+#endif
+
+namespace fcarouge::typed_linear_algebra_internal {
+//! @brief Lazily evaluated backend expressions.
+//!
+//! @details Backends without native arithmetic expressions, such as
+//! `std::mdspan`, compose the typed operations into expression nodes. A typed
+//! matrix over an expression node carries the row and column indexes of the
+//! expression, checked by the typed operations as for any other typed matrix.
+//! The nodes hold their operands by value: backend views or other nodes. The
+//! expression is evaluated on assignment into a typed matrix destination,
+//! lowered to `std::linalg` algorithms. Backends with native expressions, such
+//! as Eigen, keep composing their own lazily evaluated expressions.
+enum class expression_operation { sum, difference, product, transposed };
+
+//! @brief Whether the type is a lazily evaluated backend expression node.
+template <typename Type>
+constexpr bool is_expression{
+    requires { std::remove_cvref_t<Type>::operation; }};
+
+#ifdef __cpp_lib_linalg
+
+//! @brief The compile-time count of rows, or columns, of an operand.
+template <typename Operand, std::size_t Rank>
+constexpr std::size_t extent_of{
+    std::remove_cvref_t<Operand>::extents_type::static_extent(Rank)};
+
+//! @brief The scalar type of an operand.
+template <typename Operand>
+using element_of =
+    std::remove_cvref_t<typename std::remove_cvref_t<Operand>::element_type>;
+
+template <typename Lhs, typename Rhs> struct sum_expression {
+  static constexpr auto operation{expression_operation::sum};
+  using element_type = std::common_type_t<element_of<Lhs>, element_of<Rhs>>;
+  using extents_type =
+      std::extents<std::size_t, extent_of<Lhs, 0>, extent_of<Lhs, 1>>;
+
+  Lhs lhs;
+  Rhs rhs;
+};
+
+template <typename Lhs, typename Rhs> struct difference_expression {
+  static constexpr auto operation{expression_operation::difference};
+  using element_type = std::common_type_t<element_of<Lhs>, element_of<Rhs>>;
+  using extents_type =
+      std::extents<std::size_t, extent_of<Lhs, 0>, extent_of<Lhs, 1>>;
+
+  Lhs lhs;
+  Rhs rhs;
+};
+
+template <typename Lhs, typename Rhs> struct product_expression {
+  static constexpr auto operation{expression_operation::product};
+  using element_type = std::common_type_t<element_of<Lhs>, element_of<Rhs>>;
+  using extents_type =
+      std::extents<std::size_t, extent_of<Lhs, 0>, extent_of<Rhs, 1>>;
+
+  Lhs lhs;
+  Rhs rhs;
+};
+
+template <typename Operand> struct transposed_expression {
+  static constexpr auto operation{expression_operation::transposed};
+  using element_type = element_of<Operand>;
+  using extents_type =
+      std::extents<std::size_t, extent_of<Operand, 1>, extent_of<Operand, 0>>;
+
+  Operand operand;
+};
+
+//! @brief Lowering of the expression nodes to `std::linalg` algorithms.
+//!
+//! @details The sums and differences accumulate their terms in the
+//! destination, the products are computed by the updating matrix product
+//! overloads, and a transposition is a `std::linalg::transposed` view. Only
+//! the nested expression operands of products and transpositions are evaluated
+//! into temporaries. The lowering writes the destination while it reads the
+//! operands: the callers evaluate the operands aliasing the destination into a
+//! temporary first.
+struct linalg_lowering {
+  //! @brief Call the function with a backend view of the operand.
+  //!
+  //! @details The nested expression operands are evaluated into a temporary,
+  //! alive for the duration of the call.
+  static constexpr void view(const auto &operand, auto &&function) {
+    using operand_t = std::remove_cvref_t<decltype(operand)>;
+
+    if constexpr (not is_expression<operand_t>) {
+      function(operand);
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::transposed) {
+      view(operand.operand, [&function](const auto &value) {
+        function(std::linalg::transposed(value));
+      });
+    } else {
+      temporary(operand, function);
+    }
+  }
+
+  //! @brief Call the function with a temporary evaluation of the operand.
+  //!
+  //! @details The temporary is alive for the duration of the call.
+  static constexpr void temporary(const auto &operand, auto &&function) {
+    using operand_t = std::remove_cvref_t<decltype(operand)>;
+    using element_type = element_of<operand_t>;
+    using extents_type = operand_t::extents_type;
+
+    std::array<element_type, extent_of<operand_t, 0> * extent_of<operand_t, 1>>
+        storage;
+    const std::mdspan<element_type, extents_type> value{storage.data()};
+    assign(operand, value);
+    function(value);
+  }
+
+  //! @brief Whether the storage of the destination overlaps the storage of any
+  //! leaf operand of the expression.
+  //!
+  //! @details Leaf operands of unknown storage are assumed to alias.
+  [[nodiscard]] static constexpr bool aliases(const auto &operand,
+                                              const auto &destination) {
+    using operand_t = std::remove_cvref_t<decltype(operand)>;
+
+    if constexpr (not is_expression<operand_t>) {
+      if constexpr (requires {
+                      std::to_address(operand.data_handle());
+                      operand.mapping().required_span_size();
+                    }) {
+        const std::less<const void *> less;
+        const auto *operand_first{std::to_address(operand.data_handle())};
+        const auto *destination_first{
+            std::to_address(destination.data_handle())};
+
+        return less(operand_first, destination_first +
+                                       destination.mapping()
+                                           .required_span_size()) &&
+               less(destination_first,
+                    operand_first + operand.mapping().required_span_size());
+      } else {
+        return true;
+      }
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::transposed) {
+      return aliases(operand.operand, destination);
+    } else {
+      return aliases(operand.lhs, destination) ||
+             aliases(operand.rhs, destination);
+    }
+  }
+
+  //! @brief The operand, negated if requested.
+  template <bool Negated>
+  [[nodiscard]] static constexpr auto signed_view(const auto &value) {
+    if constexpr (Negated) {
+      return std::linalg::scaled(element_of<decltype(value)>{-1}, value);
+    } else {
+      return value;
+    }
+  }
+
+  //! @brief Evaluate the operand into the destination.
+  static constexpr void assign(const auto &operand, const auto &destination) {
+    using operand_t = std::remove_cvref_t<decltype(operand)>;
+
+    if constexpr (not is_expression<operand_t>) {
+      std::linalg::copy(operand, destination);
+    } else if constexpr (operand_t::operation == expression_operation::sum) {
+      assign(operand.lhs, destination);
+      accumulate<false>(operand.rhs, destination);
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::difference) {
+      assign(operand.lhs, destination);
+      accumulate<true>(operand.rhs, destination);
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::product) {
+      view(operand.lhs, [&operand, &destination](const auto &lhs) {
+        view(operand.rhs, [&lhs, &destination](const auto &rhs) {
+          std::linalg::matrix_product(lhs, rhs, destination);
+        });
+      });
+    } else {
+      view(operand, [&destination](const auto &value) {
+        std::linalg::copy(value, destination);
+      });
+    }
+  }
+
+  //! @brief Add, or substract if negated, the operand to the destination.
+  template <bool Negated>
+  static constexpr void accumulate(const auto &operand,
+                                   const auto &destination) {
+    using operand_t = std::remove_cvref_t<decltype(operand)>;
+
+    if constexpr (not is_expression<operand_t>) {
+      std::linalg::add(destination, signed_view<Negated>(operand),
+                       destination);
+    } else if constexpr (operand_t::operation == expression_operation::sum) {
+      accumulate<Negated>(operand.lhs, destination);
+      accumulate<Negated>(operand.rhs, destination);
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::difference) {
+      accumulate<Negated>(operand.lhs, destination);
+      accumulate<not Negated>(operand.rhs, destination);
+    } else if constexpr (operand_t::operation ==
+                         expression_operation::product) {
+      view(operand.lhs, [&operand, &destination](const auto &lhs) {
+        view(operand.rhs, [&lhs, &destination](const auto &rhs) {
+          std::linalg::matrix_product(lhs, signed_view<Negated>(rhs),
+                                      destination, destination);
+        });
+      });
+    } else {
+      view(operand, [&destination](const auto &value) {
+        std::linalg::add(destination, signed_view<Negated>(value),
+                         destination);
+      });
+    }
+  }
+};
+
+//! @brief Evaluate the expression into the destination backend view.
+//!
+//! @details As with Eigen assignments, an expression reading the destination
+//! is evaluated into a temporary first, then copied into the destination.
+//! Otherwise the expression is evaluated directly into the destination.
+constexpr void evaluate(const auto &expression, const auto &destination)
+  requires is_expression<decltype(expression)>
+{
+  if (linalg_lowering::aliases(expression, destination)) {
+    linalg_lowering::temporary(expression, [&destination](const auto &value) {
+      std::linalg::copy(value, destination);
+    });
+  } else {
+    linalg_lowering::assign(expression, destination);
+  }
+}
+
+//! @brief Evaluate the expression directly into the destination backend view.
+//!
+//! @details As with Eigen `noalias()`, no aliasing analysis is performed: the
+//! destination must not alias the expression operands, except within the
+//! nested expression operands of products, evaluated into temporaries
+//! beforehand.
+constexpr void evaluate_noalias(const auto &expression,
+                                const auto &destination)
+  requires is_expression<decltype(expression)>
+{
+  linalg_lowering::assign(expression, destination);
+}
+
+#endif
+
+//! @brief The sum of two backend operands.
+//!
+//! @details The native expression of the backend, or a lazily evaluated
+//! expression node for backends without arithmetic operators.
+[[nodiscard]] constexpr auto plus(const auto &lhs, const auto &rhs) {
+  return lhs + rhs;
+}
+
+//! @brief The difference of two backend operands.
+//!
+//! @see plus
+[[nodiscard]] constexpr auto minus(const auto &lhs, const auto &rhs) {
+  return lhs - rhs;
+}
+
+//! @brief The product of two backend operands.
+//!
+//! @see plus
+[[nodiscard]] constexpr auto times(const auto &lhs, const auto &rhs) {
+  return lhs * rhs;
+}
+
+//! @brief Add the backend operand to the destination, in place.
+//!
+//! @details The native compound assignment of the backend, or the
+//! `std::linalg` algorithms writing their output over the destination for
+//! backends without arithmetic operators. No second destination buffer is
+//! needed, unless the operand reads the destination: as with Eigen, it is
+//! then evaluated into a temporary first.
+constexpr void plus_assign(auto &destination, const auto &operand) {
+  destination += operand;
+}
+
+//! @brief Substract the backend operand from the destination, in place.
+//!
+//! @see plus_assign
+constexpr void minus_assign(auto &destination, const auto &operand) {
+  destination -= operand;
+}
+
+//! @brief Multiply the destination by the backend operand or scalar, in place.
+//!
+//! @details Multiplying by a matrix operand needs the whole row of the
+//! destination while writing it: the product is evaluated into a temporary
+//! for backends without arithmetic operators, as Eigen does.
+//!
+//! @see plus_assign
+constexpr void times_assign(auto &destination, const auto &operand) {
+  destination *= operand;
+}
+
+//! @brief Divide the destination by the scalar, in place.
+//!
+//! @see plus_assign
+constexpr void divides_assign(auto &destination, const auto &operand) {
+  destination /= operand;
+}
+
+#ifdef __cpp_lib_linalg
+
+[[nodiscard]] constexpr auto plus(const auto &lhs, const auto &rhs)
+  requires(not requires { lhs + rhs; })
+{
+  return sum_expression<std::remove_cvref_t<decltype(lhs)>,
+                        std::remove_cvref_t<decltype(rhs)>>{lhs, rhs};
+}
+
+[[nodiscard]] constexpr auto minus(const auto &lhs, const auto &rhs)
+  requires(not requires { lhs - rhs; })
+{
+  return difference_expression<std::remove_cvref_t<decltype(lhs)>,
+                               std::remove_cvref_t<decltype(rhs)>>{lhs, rhs};
+}
+
+[[nodiscard]] constexpr auto times(const auto &lhs, const auto &rhs)
+  requires(not requires { lhs * rhs; })
+{
+  return product_expression<std::remove_cvref_t<decltype(lhs)>,
+                            std::remove_cvref_t<decltype(rhs)>>{lhs, rhs};
+}
+
+constexpr void plus_assign(auto &destination, const auto &operand)
+  requires(not requires { destination += operand; })
+{
+  if (linalg_lowering::aliases(operand, destination)) {
+    linalg_lowering::temporary(operand, [&destination](const auto &value) {
+      linalg_lowering::accumulate<false>(value, destination);
+    });
+  } else {
+    linalg_lowering::accumulate<false>(operand, destination);
+  }
+}
+
+constexpr void minus_assign(auto &destination, const auto &operand)
+  requires(not requires { destination -= operand; })
+{
+  if (linalg_lowering::aliases(operand, destination)) {
+    linalg_lowering::temporary(operand, [&destination](const auto &value) {
+      linalg_lowering::accumulate<true>(value, destination);
+    });
+  } else {
+    linalg_lowering::accumulate<true>(operand, destination);
+  }
+}
+
+constexpr void times_assign(auto &destination, const auto &operand)
+  requires(not requires { destination *= operand; })
+{
+  using destination_t = std::remove_cvref_t<decltype(destination)>;
+  using operand_t = std::remove_cvref_t<decltype(operand)>;
+
+  if constexpr (not requires { typename operand_t::extents_type; }) {
+    std::linalg::scale(operand, destination);
+  } else {
+    linalg_lowering::view(
+        product_expression<destination_t, operand_t>{destination, operand},
+        [&destination](const auto &value) {
+          std::linalg::copy(value, destination);
+        });
+  }
+}
+
+constexpr void divides_assign(auto &destination, const auto &operand)
+  requires(not requires { destination /= operand; })
+{
+  std::linalg::scale(element_of<decltype(destination)>{1} / operand,
+                     destination);
+}
+
+#endif
+
+//! @brief Assign the backend operand to the destination without aliasing
+//! guard.
+//!
+//! @details Eigen `noalias()` writes the products directly into the
+//! destination rather than into a temporary first. The expression nodes are
+//! evaluated directly into the destination, see `evaluate_noalias`.
+constexpr void noalias_assign(auto &&destination, const auto &operand) {
+  if constexpr (requires { destination.noalias() = operand; }) {
+    destination.noalias() = operand;
+  } else if constexpr (is_expression<decltype(operand)>) {
+    evaluate_noalias(operand, destination);
+  } else {
+    destination = operand;
+  }
+}
+
+//! @brief Add the backend operand to the destination without aliasing guard.
+//!
+//! @details The `std::linalg` algorithms accumulate the operand directly into
+//! the destination for backends without arithmetic operators, without the
+//! aliasing analysis of `plus_assign`.
+//!
+//! @see noalias_assign
+constexpr void noalias_plus_assign(auto &destination, const auto &operand) {
+  if constexpr (requires { destination.noalias() += operand; }) {
+    destination.noalias() += operand;
+  } else {
+    destination += operand;
+  }
+}
+
+//! @brief Substract the backend operand from the destination without aliasing
+//! guard.
+//!
+//! @see noalias_plus_assign
+constexpr void noalias_minus_assign(auto &destination, const auto &operand) {
+  if constexpr (requires { destination.noalias() -= operand; }) {
+    destination.noalias() -= operand;
+  } else {
+    destination -= operand;
+  }
+}
+
+#ifdef __cpp_lib_linalg
+
+constexpr void noalias_plus_assign(auto &destination, const auto &operand)
+  requires(not requires { destination += operand; })
+{
+  linalg_lowering::accumulate<false>(operand, destination);
+}
+
+constexpr void noalias_minus_assign(auto &destination, const auto &operand)
+  requires(not requires { destination -= operand; })
+{
+  linalg_lowering::accumulate<true>(operand, destination);
+}
+
+#endif
+
+//! @brief The column vector view of a row or column backend vector.
+//!
+//! @details A typed row or column vector is stored as a rank two, n-by-one or
+//! one-by-n, backend matrix. The vector algorithms view either orientation as
+//! a column vector: the native reshaping of the backend, or the rank one span
+//! required by the `std::linalg` vector concepts.
+[[nodiscard]] constexpr auto vector_view(auto &&vector) {
+  return vector.reshaped();
+}
+
+//! @brief Write the sum of the backend operands into the result.
+//!
+//! @details The native expression is assigned without aliasing guard, or the
+//! `std::linalg` algorithm writes into the result for backends without
+//! arithmetic operators. Neither evaluates into a temporary.
+constexpr void add_into(const auto &lhs, const auto &rhs, auto &&result) {
+  noalias_assign(result, lhs + rhs);
+}
+
+//! @brief Write the product of the backend operands into the result.
+//!
+//! @see add_into
+constexpr void matrix_product_into(const auto &lhs, const auto &rhs,
+                                   auto &&result) {
+  noalias_assign(result, lhs * rhs);
+}
+
+//! @brief Write the product of the backend matrix and vector into the result
+//! vector.
+//!
+//! @see add_into
+constexpr void matrix_vector_product_into(const auto &lhs, const auto &rhs,
+                                          auto &&result) {
+  noalias_assign(vector_view(result), lhs * vector_view(rhs));
+}
+
+//! @brief Write the sum of the update and of the product of the backend
+//! operands into the result.
+//!
+//! @details The result may be the update. Eigen assigns the update, then
+//! accumulates the product into the result without temporary. The updating
+//! `std::linalg` algorithm does the same in a single pass.
+//!
+//! @see add_into
+constexpr void matrix_product_into(const auto &lhs, const auto &rhs,
+                                   const auto &update, auto &&result) {
+  noalias_assign(result, update + lhs * rhs);
+}
+
+//! @brief Write the sum of the update vector and of the product of the
+//! backend matrix and vector into the result vector.
+//!
+//! @see matrix_product_into
+constexpr void matrix_vector_product_into(const auto &lhs, const auto &rhs,
+                                          const auto &update, auto &&result) {
+  noalias_assign(vector_view(result),
+                 vector_view(update) + lhs * vector_view(rhs));
+}
+
+#ifdef __cpp_lib_linalg
+
+[[nodiscard]] constexpr auto vector_view(auto &&vector)
+  requires requires { vector.data_handle(); }
+{
+  using vector_t = std::remove_cvref_t<decltype(vector)>;
+
+  return std::mdspan<typename vector_t::element_type,
+                     std::extents<std::size_t, extent_of<vector_t, 0> *
+                                                   extent_of<vector_t, 1>>>(
+      vector.data_handle());
+}
+
+constexpr void add_into(const auto &lhs, const auto &rhs, auto &&result)
+  requires(not requires { lhs + rhs; })
+{
+  std::linalg::add(lhs, rhs, result);
+}
+
+constexpr void matrix_product_into(const auto &lhs, const auto &rhs,
+                                   auto &&result)
+  requires(not requires { lhs * rhs; })
+{
+  std::linalg::matrix_product(lhs, rhs, result);
+}
+
+constexpr void matrix_vector_product_into(const auto &lhs, const auto &rhs,
+                                          auto &&result)
+  requires(not requires { lhs * rhs; })
+{
+  std::linalg::matrix_vector_product(lhs, vector_view(rhs),
+                                     vector_view(result));
+}
+
+constexpr void matrix_product_into(const auto &lhs, const auto &rhs,
+                                   const auto &update, auto &&result)
+  requires(not requires { lhs * rhs; })
+{
+  std::linalg::matrix_product(lhs, rhs, update, result);
+}
+
+constexpr void matrix_vector_product_into(const auto &lhs, const auto &rhs,
+                                          const auto &update, auto &&result)
+  requires(not requires { lhs * rhs; })
+{
+  std::linalg::matrix_vector_product(lhs, vector_view(rhs),
+                                     vector_view(update), vector_view(result));
+}
+
+#endif
+} // namespace fcarouge::typed_linear_algebra_internal
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPRESSION_HPP
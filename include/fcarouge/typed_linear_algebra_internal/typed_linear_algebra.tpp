@@ -39,8 +39,8 @@ template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes>::typed_matrix()
   requires std::default_initializable<Matrix>
     : storage{} {
-  if constexpr (requires { Matrix::Zero(); }) {
-    storage = Matrix::Zero();
+  if constexpr (requires { tla::innermost_t<Matrix>::Zero(); }) {
+    storage = tla::innermost_t<Matrix>::Zero();
   }
 }
 
@@ -55,7 +55,13 @@ template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
 typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator=(
     const same_as_typed_matrix auto &other) {
-  storage = other.data();
+  // The expression evaluation is found by argument-dependent lookup, only
+  // declared with `std::linalg` support.
+  if constexpr (tla::is_expression<decltype(other.data())>) {
+    evaluate(other.data(), storage);
+  } else {
+    storage = other.data();
+  }
   return *this;
 }
 
@@ -70,14 +76,118 @@ template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
 typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator=(
     same_as_typed_matrix auto &&other) {
-  storage = std::forward<decltype(other)>(other).data();
+  if constexpr (tla::is_expression<decltype(other.data())>) {
+    evaluate(other.data(), storage);
+  } else {
+    storage = std::forward<decltype(other)>(other).data();
+  }
+  return *this;
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
+typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator+=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(same_shape<typed_matrix, other_matrix>,
+                "Matrix addition requires matrices of the same shapes, sizes.");
+
+  // Each typed element sum must be assignable to the corresponding typed
+  // element of this matrix.
+  static_assert(tla::elementwise_compatible<tla::addable_to, typed_matrix,
+                                            typed_matrix, other_matrix>(),
+                "Matrix addition requires compatible element types.");
+
+  tla::plus_assign(storage, other.data());
+  return *this;
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
+typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator-=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(
+      same_shape<typed_matrix, other_matrix>,
+      "Matrix subtraction requires matrices of the same shapes, sizes.");
+
+  // Each typed element difference must be assignable to the corresponding
+  // typed element of this matrix.
+  static_assert(tla::elementwise_compatible<tla::substractable_to,
+                                            typed_matrix, typed_matrix,
+                                            other_matrix>(),
+                "Matrix subtraction requires compatible element types.");
+
+  tla::minus_assign(storage, other.data());
+  return *this;
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
+typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator*=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(multipliable<typed_matrix, other_matrix>,
+                "Matrix product requires multipliable matrices.");
+
+  static_assert(other_matrix::rows == other_matrix::columns,
+                "Matrix product assignment requires a square right-hand side "
+                "matrix.");
+
+  // Each typed element of the product must be assignable to the corresponding
+  // typed element of this matrix.
+  static_assert(tla::elementwise_compatible<
+                    tla::assignable, typed_matrix,
+                    tla::product_indexes<typed_matrix, other_matrix>>(),
+                "Matrix product requires compatible element types.");
+
+  tla::times_assign(storage, other.data());
+  return *this;
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
+typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator*=(
+    const other auto &value) {
+  using type = std::remove_cvref_t<decltype(value)>;
+
+  // Each scaled typed element must be assignable to the corresponding typed
+  // element of this matrix.
+  static_assert(tla::elementwise_compatible<
+                    tla::assignable, typed_matrix,
+                    tla::indexes<tla::product<row_indexes, type>,
+                                 column_indexes>>(),
+                "Matrix scaling requires a compatible scalar type.");
+
+  tla::times_assign(storage, cast<underlying, type>(value));
+  return *this;
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes> &
+typed_matrix<Matrix, RowIndexes, ColumnIndexes>::operator/=(
+    const other auto &value) {
+  using type = std::remove_cvref_t<decltype(value)>;
+
+  // Each divided typed element must be assignable to the corresponding typed
+  // element of this matrix.
+  static_assert(tla::elementwise_compatible<
+                    tla::assignable, typed_matrix,
+                    tla::indexes<tla::quotient<row_indexes, type>,
+                                 column_indexes>>(),
+                "Matrix division requires a compatible scalar type.");
+
+  tla::divides_assign(storage, cast<underlying, type>(value));
   return *this;
 }
 
 template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes>::typed_matrix(
     const Matrix &other)
-    : storage{other} {}
+    : storage{tla::innermost_data(other)} {}
 
 template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 constexpr typed_matrix<Matrix, RowIndexes, ColumnIndexes>::typed_matrix(
@@ -355,10 +465,7 @@ constexpr void typed_matrix<Matrix, RowIndexes, ColumnIndexes>::at(
   //! conversion and access pattern internally. This could simplify the
   //! implementation and improve readability. The overload set could support
   //! both the write and read operations.
-  if constexpr (same_as_typed_matrix<Matrix>) {
-    self.storage.template at<Indexes...>(
-        cast<underlying, element<Indexes...>>(value));
-  } else if constexpr (requires {
+  if constexpr (requires {
                          self.storage(std::size_t{Indexes}...) =
                              cast<underlying, element<Indexes...>>(value);
                        }) {
@@ -395,6 +502,77 @@ template <typename RowIndexes, typename ColumnIndexes>
       std::forward<type>(value)};
 }
 
+template <typename TypedMatrix>
+constexpr noalias_typed_matrix<TypedMatrix>::noalias_typed_matrix(
+    TypedMatrix &destination)
+    : destination{destination} {}
+
+template <typename TypedMatrix>
+constexpr noalias_typed_matrix<TypedMatrix> &
+noalias_typed_matrix<TypedMatrix>::operator=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(
+      same_shape<TypedMatrix, other_matrix>,
+      "Matrix assignment requires matrices of the same shapes, sizes.");
+
+  // Each typed element must be assignable to the corresponding typed element
+  // of the destination matrix.
+  static_assert(tla::elementwise_compatible<tla::assignable, TypedMatrix,
+                                            other_matrix>(),
+                "Matrix assignment requires compatible element types.");
+
+  tla::noalias_assign(destination.data(), other.data());
+  return *this;
+}
+
+template <typename TypedMatrix>
+constexpr noalias_typed_matrix<TypedMatrix> &
+noalias_typed_matrix<TypedMatrix>::operator+=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(same_shape<TypedMatrix, other_matrix>,
+                "Matrix addition requires matrices of the same shapes, sizes.");
+
+  // Each typed element sum must be assignable to the corresponding typed
+  // element of the destination matrix.
+  static_assert(tla::elementwise_compatible<tla::addable_to, TypedMatrix,
+                                            TypedMatrix, other_matrix>(),
+                "Matrix addition requires compatible element types.");
+
+  tla::noalias_plus_assign(destination.data(), other.data());
+  return *this;
+}
+
+template <typename TypedMatrix>
+constexpr noalias_typed_matrix<TypedMatrix> &
+noalias_typed_matrix<TypedMatrix>::operator-=(
+    const same_as_typed_matrix auto &other) {
+  using other_matrix = std::remove_cvref_t<decltype(other)>;
+
+  static_assert(
+      same_shape<TypedMatrix, other_matrix>,
+      "Matrix subtraction requires matrices of the same shapes, sizes.");
+
+  // Each typed element difference must be assignable to the corresponding
+  // typed element of the destination matrix.
+  static_assert(tla::elementwise_compatible<tla::substractable_to,
+                                            TypedMatrix, TypedMatrix,
+                                            other_matrix>(),
+                "Matrix subtraction requires compatible element types.");
+
+  tla::noalias_minus_assign(destination.data(), other.data());
+  return *this;
+}
+
+[[nodiscard]] constexpr auto noalias(same_as_typed_matrix auto &destination) {
+  using matrix = std::remove_cvref_t<decltype(destination)>;
+
+  return noalias_typed_matrix<matrix>{destination};
+}
+
 template <int Index> decltype(auto) get(rank_typed_matrix<1> auto &&value) {
   return (value.template at<Index>());
 }
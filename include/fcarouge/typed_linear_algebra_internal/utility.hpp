@@ -34,6 +34,8 @@ For more information, please refer to <https://unlicense.org> */
 
 #include "fcarouge/typed_linear_algebra_forward.hpp"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <functional>
@@ -42,6 +44,22 @@ For more information, please refer to <https://unlicense.org> */
 #include <utility>
 
 namespace fcarouge::typed_linear_algebra_internal {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS
+//! @brief Opt-in compile-time instantiation diagnostics.
+//!
+//! @details Enabled by defining the `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS`
+//! macro before including the library. Each distinct instantiation of the
+//! `element_at`, `product`, and `quotient` metafunctions then emits its marker
+//! string once in the object file, for example
+//! `fcarouge.typed_linear_algebra.product`. Counting the markers of an object
+//! file attributes its compile cost to these metafunctions, see the
+//! `compile_bench` benchmarks. The metafunctions results are unchanged. The
+//! markers rely on the `gnu::used` attribute of GCC and Clang.
+//!
+//! @return Whether the marker is emitted, naming it odr-uses it.
+consteval bool marked(const char *marker) { return marker != nullptr; }
+#endif
+
 //! @brief Linear algebra divides expression type specialization point.
 //!
 //! @details Matrix division is a mathematical abuse of terminology. Informally
@@ -57,9 +75,22 @@ template <typename Lhs, typename Rhs> struct divides {
       -> decltype(lhs / rhs);
 };
 
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS
+template <typename Lhs, typename Rhs>
+struct quotient_t
+    : std::invoke_result<divides<Lhs, Rhs>, const Lhs &, const Rhs &> {
+  [[gnu::used]] static constexpr char instantiation[]{
+      "fcarouge.typed_linear_algebra.quotient"};
+  static_assert(marked(instantiation));
+};
+
+template <typename Lhs, typename Rhs>
+using quotient = quotient_t<Lhs, Rhs>::type;
+#else
 template <typename Lhs, typename Rhs>
 using quotient =
     std::invoke_result_t<divides<Lhs, Rhs>, const Lhs &, const Rhs &>;
+#endif
 
 template <> struct divides<std::identity, std::identity> {
   [[nodiscard]] static constexpr auto operator()(const std::identity &lhs,
@@ -119,8 +150,20 @@ template <typename Lhs, typename Rhs> struct multiplies {
       -> decltype(lhs * rhs);
 };
 
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS
+template <typename Lhs, typename Rhs>
+struct product_t : std::invoke_result<multiplies<Lhs, Rhs>, Lhs, Rhs> {
+  [[gnu::used]] static constexpr char instantiation[]{
+      "fcarouge.typed_linear_algebra.product"};
+  static_assert(marked(instantiation));
+};
+
+template <typename Lhs, typename Rhs>
+using product = product_t<Lhs, Rhs>::type;
+#else
 template <typename Lhs, typename Rhs>
 using product = std::invoke_result_t<multiplies<Lhs, Rhs>, Lhs, Rhs>;
+#endif
 
 template <typename Lhs>
   requires(not std::same_as<Lhs, std::identity>)
@@ -165,17 +208,267 @@ struct multiplies<std::tuple<Types1...>, std::tuple<Types2...>> {
       -> std::tuple<product<Types1, Types2>...>;
 };
 
-template <std::size_t... Is, typename F>
-constexpr void for_constexpr_detail(std::index_sequence<Is...>, F &&f) {
-  (f(std::integral_constant<std::size_t, Is>{}), ...);
+#ifndef __cpp_pack_indexing
+//! @brief Type tagged with its index in a flat type list.
+template <std::size_t Index, typename Type> struct indexed {
+  using type = Type;
+};
+
+//! @brief Flat inheritance of every indexed type of a type list.
+template <typename Sequence, typename... Types> struct indexer;
+
+template <std::size_t... Indexes, typename... Types>
+struct indexer<std::index_sequence<Indexes...>, Types...>
+    : indexed<Indexes, Types>... {};
+
+//! @brief Selects the base of the indexer at the given index by overload
+//! resolution, without recursion.
+template <std::size_t Index, typename Type>
+auto select(const indexed<Index, Type> &) -> indexed<Index, Type>;
+#endif
+
+//! @brief The type at the given index of a pack.
+#ifdef __cpp_pack_indexing
+template <std::size_t Index, typename... Types>
+using pack_at = Types...[Index];
+#else
+template <std::size_t Index, typename... Types>
+using pack_at = typename decltype(select<Index>(
+    indexer<std::index_sequence_for<Types...>, Types...>{}))::type;
+#endif
+
+//! @brief Run of consecutive indexes of the same type.
+//!
+//! @details A plain index type is a run of one index, a `repeat` descriptor is
+//! a run of its count of indexes.
+template <typename Type> struct run {
+  using type = Type;
+
+  static constexpr std::size_t count{1};
+};
+
+template <typename Type, std::size_t Count> struct run<repeat<Type, Count>> {
+  using type = Type;
+
+  static constexpr std::size_t count{Count};
+};
+
+//! @brief Whether the type is a `repeat` run-length index descriptor.
+template <typename Type> inline constexpr bool is_repeat{false};
+
+template <typename Type, std::size_t Count>
+inline constexpr bool is_repeat<repeat<Type, Count>>{true};
+
+//! @brief Run of the index types computed index by index over two runs.
+//!
+//! @details Runs pair index by index only when their counts are equal.
+//! Otherwise the computed run would straddle the runs of the other operand.
+template <typename Type, std::size_t Count1, std::size_t Count2>
+struct paired_run {
+  static_assert(Count1 == Count2,
+                "Run-length index descriptors combine index by index only "
+                "with the same count.");
+
+  using type = repeat<Type, Count1>;
+};
+
+template <typename Type, std::size_t Count1, std::size_t Count2>
+using paired_run_t = paired_run<Type, Count1, Count2>::type;
+
+//! @brief Unique address of a type, comparable in constant expressions.
+template <typename Type> inline constexpr char type_id{};
+
+//! @brief Flat list of runs of index types.
+//!
+//! @details Internal representation of the row and column index types. The
+//! types are indexed through pack indexing, or flat overload resolution
+//! without it, in constant instantiation depth rather than the recursion of
+//! most `std::tuple_element` implementations. An index is first located in
+//! its run, in as many constant evaluation steps as there are runs, only
+//! when the list holds `repeat` descriptors. The `std::tuple` index types are
+//! converted once per typed matrix, see its `row_list` and `column_list`, or at
+//! the interface boundary, see `type_at`.
+template <typename... Types> struct type_list {
+  //! @brief Whether every run is a single index.
+  static constexpr bool flat{((run<Types>::count == 1) and ...)};
+
+  //! @brief The count of indexes.
+  static constexpr std::size_t size{(run<Types>::count + ... + 0)};
+
+  //! @brief The first index of each run.
+  static constexpr std::array<std::size_t, sizeof...(Types)> starts{[] {
+    std::array<std::size_t, sizeof...(Types)> result{};
+    std::size_t start{0};
+    std::size_t position{0};
+    ((result[position++] = start, start += run<Types>::count), ...);
+    return result;
+  }()};
+
+  //! @brief The position of the run holding the given index.
+  template <std::size_t Index>
+  static constexpr std::size_t locate{[] {
+    if constexpr (flat) {
+      return Index;
+    } else {
+      std::size_t position{0};
+      while (position + 1 < starts.size() and starts[position + 1] <= Index) {
+        ++position;
+      }
+      return position;
+    }
+  }()};
+
+  template <std::size_t Index>
+  using at = typename run<pack_at<locate<Index>, Types...>>::type;
+
+  //! @brief The identifier of the type of each run.
+  static constexpr std::array<const char *, sizeof...(Types)> ids{
+      &type_id<typename run<Types>::type>...};
+
+  //! @brief The identifier of the type at the given index, located in
+  //! constant evaluation steps rather than template instantiations.
+  static constexpr const char *id(std::size_t index) {
+    std::size_t position{0};
+    while (position + 1 < starts.size() and starts[position + 1] <= index) {
+      ++position;
+    }
+    return ids[position];
+  }
+};
+
+template <typename Tuple> struct to_type_list;
+
+template <typename... Types> struct to_type_list<std::tuple<Types...>> {
+  using type = type_list<Types...>;
+};
+
+template <typename Tuple>
+using type_list_t = typename to_type_list<std::remove_cvref_t<Tuple>>::type;
+
+//! @brief The type at the given index of a tuple of index types.
+template <std::size_t Index, typename Tuple>
+using type_at = typename type_list_t<Tuple>::template at<Index>;
+
+//! @brief The count of indexes of a tuple of index types.
+template <typename Tuple>
+constexpr std::size_t size_of{type_list_t<Tuple>::size};
+
+//! @brief Whether the index types of the tuples are runs of the same counts.
+template <typename Tuple1, typename Tuple2>
+inline constexpr bool same_runs{false};
+
+template <typename... Types1, typename... Types2>
+  requires(sizeof...(Types1) == sizeof...(Types2))
+inline constexpr bool same_runs<std::tuple<Types1...>, std::tuple<Types2...>>{
+    ((run<Types1>::count == run<Types2>::count) and ...)};
+
+//! @brief Index types computed index by index over the expanded indexes of
+//! two tuples.
+template <template <typename, typename> typename Operation, typename Tuple1,
+          typename Tuple2,
+          typename = std::make_index_sequence<size_of<Tuple1>>>
+struct expanded_pairs;
+
+template <template <typename, typename> typename Operation, typename Tuple1,
+          typename Tuple2, std::size_t... Indexes>
+struct expanded_pairs<Operation, Tuple1, Tuple2,
+                      std::index_sequence<Indexes...>> {
+  static_assert(size_of<Tuple1> == size_of<Tuple2>,
+                "Index types combine index by index only with the same count "
+                "of indexes.");
+
+  using type = std::tuple<
+      Operation<type_at<Indexes, Tuple1>, type_at<Indexes, Tuple2>>...>;
+};
+
+//! @brief Index types of tuples of different runs computed index by index.
+//!
+//! @details The runs of either tuple would straddle the runs of the other,
+//! for example `std::tuple<repeat<m, 2>, s>` and `std::tuple<m, m, s>`. Both
+//! tuples are expanded to one index type per index first. Tuples of the same
+//! runs keep them.
+template <typename... Types1, typename... Types2>
+  requires(not same_runs<std::tuple<Types1...>, std::tuple<Types2...>>)
+struct multiplies<std::tuple<Types1...>, std::tuple<Types2...>> {
+  [[nodiscard]] static constexpr auto
+  operator()(const std::tuple<Types1...> &lhs, const std::tuple<Types2...> &rhs)
+      -> expanded_pairs<product, std::tuple<Types1...>,
+                        std::tuple<Types2...>>::type;
+};
+
+template <typename... Types1, typename... Types2>
+  requires(not same_runs<std::tuple<Types1...>, std::tuple<Types2...>>)
+struct divides<std::tuple<Types1...>, std::tuple<Types2...>> {
+  [[nodiscard]] static constexpr auto
+  operator()(const std::tuple<Types1...> &lhs, const std::tuple<Types2...> &rhs)
+      -> expanded_pairs<quotient, std::tuple<Types1...>,
+                        std::tuple<Types2...>>::type;
+};
+
+//! @brief Count of indexes expanded per fold of the chunked iteration.
+inline constexpr std::size_t for_constexpr_chunk{64};
+
+template <std::size_t Offset, std::size_t... Is, typename Function>
+constexpr void for_constexpr_chunk_detail(std::index_sequence<Is...>,
+                                          Function &function) {
+  (function(std::integral_constant<std::size_t, Offset + Is>{}), ...);
+}
+
+//! @brief Count of indexes of the given chunk, the last chunk may be partial.
+template <std::size_t Size, std::size_t Chunk>
+inline constexpr std::size_t chunk_size{
+    std::min(for_constexpr_chunk, Size - Chunk * for_constexpr_chunk)};
+
+template <std::size_t Size, std::size_t... Chunks, typename Function>
+constexpr void for_constexpr_detail(std::index_sequence<Chunks...>,
+                                    Function &function) {
+  (for_constexpr_chunk_detail<Chunks * for_constexpr_chunk>(
+       std::make_index_sequence<chunk_size<Size, Chunks>>{}, function),
+   ...);
 }
 
-//! @todo Remove for C++26 P1789 Library Support for Expansion Statements.
+//! @brief Calls the function with each index, in order, as an integral
+//! constant, by folds of at most `for_constexpr_chunk` indexes.
+//!
+//! @details The chunks bound the size of the fold expressions, and of their
+//! index sequences, the compilers build for the largest matrices.
+template <std::size_t Size, typename Function>
+constexpr void for_constexpr_chunked(Function &&function) {
+  for_constexpr_detail<Size>(
+      std::make_index_sequence<(Size + for_constexpr_chunk - 1) /
+                               for_constexpr_chunk>{},
+      function);
+}
+
+#ifdef __cpp_expansion_statements
+//! @brief Calls the function with each index, in order, as an integral
+//! constant, by an expansion statement.
+//!
+//! @details The expansion statement iterates over a constant array of the
+//! indexes, without index sequence nor fold expression.
+//!
+//! @todo Iterate over the index sequence with C++26 P1789 Library Support for
+//! Expansion Statements.
+template <std::size_t Size, typename Function>
+constexpr void for_constexpr(Function &&function) {
+  static constexpr std::array<std::size_t, Size> indexes{[] {
+    std::array<std::size_t, Size> result{};
+    for (std::size_t index{0}; index < Size; ++index) {
+      result[index] = index;
+    }
+    return result;
+  }()};
+
+  template for (constexpr std::size_t index : indexes) {
+    function(std::integral_constant<std::size_t, index>{});
+  }
+}
+#else
 template <std::size_t Size, typename Function>
 constexpr void for_constexpr(Function &&function) {
-  for_constexpr_detail(std::make_index_sequence<Size>{},
-                       std::forward<Function>(function));
+  for_constexpr_chunked<Size>(std::forward<Function>(function));
 }
+#endif
 
 template <typename Type> struct underlying {
   [[nodiscard]] static constexpr auto operator()()
@@ -205,6 +498,47 @@ concept same_as_typed_matrix = std::same_as<
                  typename std::remove_cvref_t<Type>::row_indexes,
                  typename std::remove_cvref_t<Type>::column_indexes>>;
 
+//! @brief The innermost algebraic backend of a typed matrix composition.
+//!
+//! @details A typed matrix composed over another typed matrix stores the
+//! innermost backend directly: the intermediate typed matrices are peeled at
+//! the type level and are neither stored nor traversed by element accesses
+//! and operations. The nested and flat forms share the same storage and code.
+template <typename Matrix> struct innermost {
+  using type = Matrix;
+};
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+struct innermost<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+    : innermost<Matrix> {};
+
+template <typename Matrix> using innermost_t = innermost<Matrix>::type;
+
+//! @brief Whether the indexes can describe the composed matrix.
+//!
+//! @details The outermost index description is merged over the composed ones:
+//! it must agree on the shape and it alone determines the element types.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+constexpr bool composable{true};
+
+template <typename Matrix, typename ComposedRowIndexes,
+          typename ComposedColumnIndexes, typename RowIndexes,
+          typename ColumnIndexes>
+constexpr bool composable<
+    typed_matrix<Matrix, ComposedRowIndexes, ComposedColumnIndexes>,
+    RowIndexes, ColumnIndexes>{
+    size_of<ComposedRowIndexes> == size_of<RowIndexes> and
+    size_of<ComposedColumnIndexes> == size_of<ColumnIndexes>};
+
+//! @brief The innermost algebraic backend storage of the value.
+[[nodiscard]] constexpr decltype(auto) innermost_data(auto &&value) {
+  if constexpr (same_as_typed_matrix<decltype(value)>) {
+    return std::forward<decltype(value)>(value).data();
+  } else {
+    return std::forward<decltype(value)>(value);
+  }
+}
+
 template <std::size_t Rows, std::size_t Columns>
 constexpr std::size_t rank{[] {
   if constexpr (Rows > 1 && Columns > 1) {
@@ -223,12 +557,26 @@ constexpr std::size_t rank{[] {
 //! rank-checked `element_t` specializations below and by algorithms that
 //! must visit every row and column position of a matrix regardless of its
 //! rank, for example homogeneity checks.
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS
+template <typename Type, std::size_t RowIndex, std::size_t ColumnIndex>
+struct element_at_t
+    : std::remove_cvref<product<
+          typename std::remove_cvref_t<Type>::row_list::template at<RowIndex>,
+          typename std::remove_cvref_t<
+              Type>::column_list::template at<ColumnIndex>>> {
+  [[gnu::used]] static constexpr char instantiation[]{
+      "fcarouge.typed_linear_algebra.element_at"};
+  static_assert(marked(instantiation));
+};
+
+template <typename Type, std::size_t RowIndex, std::size_t ColumnIndex>
+using element_at = element_at_t<Type, RowIndex, ColumnIndex>::type;
+#else
 template <typename Type, std::size_t RowIndex, std::size_t ColumnIndex>
 using element_at = std::remove_cvref_t<product<
-    std::tuple_element_t<RowIndex,
-                         typename std::remove_cvref_t<Type>::row_indexes>,
-    std::tuple_element_t<ColumnIndex,
-                         typename std::remove_cvref_t<Type>::column_indexes>>>;
+    typename std::remove_cvref_t<Type>::row_list::template at<RowIndex>,
+    typename std::remove_cvref_t<Type>::column_list::template at<ColumnIndex>>>;
+#endif
 
 //! @brief Linear algebra element type specialization point.
 //!
@@ -274,21 +622,97 @@ struct element_t<Type> {
 template <typename Type, std::size_t... Indexes>
 using element = element_t<Type, Indexes...>::type;
 
-template <typename Type>
-concept uniform_typed_matrix =
-    same_as_typed_matrix<Type> and ([]() {
-      bool result{true};
+//! @brief Positions of the distinct combinations of index types across index
+//! tuples.
+//!
+//! @details A position is kept when no earlier position holds the same index
+//! type in every tuple. The elements of matrices built on the tuples are thus
+//! the same types at a dropped position as at its kept one: the element-wise
+//! checks over the kept positions decide every element, in a few checks for a
+//! few index types whatever the sizes of the matrices. The elements are not
+//! decided from the first row and column alone: the index types need not
+//! cancel out as the quantities do, for example the `double` by `int` elements
+//! of `double` and `int` rows and columns are `double` but for the `int` by
+//! `int` element. The positions are compared by type identifiers in constant
+//! evaluation steps, without template instantiations.
+template <typename... Tuples>
+inline constexpr auto distinct_positions{[] {
+  constexpr std::size_t size{std::min({size_of<Tuples>...})};
+
+  struct {
+    std::array<std::size_t, size> at{};
+    std::size_t count{0};
+  } result;
+
+  for (std::size_t position{0}; position < size; ++position) {
+    bool distinct{true};
+    for (std::size_t kept{0}; distinct and kept < result.count; ++kept) {
+      distinct = ((type_list_t<Tuples>::id(position) !=
+                   type_list_t<Tuples>::id(result.at[kept])) or
+                  ...);
+    }
+    if (distinct) {
+      result.at[result.count++] = position;
+    }
+  }
+
+  return result;
+}()};
+
+//! @brief The position of the first false value, or the size if none.
+template <std::size_t Size>
+constexpr std::size_t first_false(const std::array<bool, Size> &values) {
+  std::size_t position{0};
+  while (position < Size and values[position]) {
+    ++position;
+  }
+  return position;
+}
 
-      for_constexpr<std::remove_cvref_t<Type>::rows>([&result](auto i) {
-        for_constexpr<std::remove_cvref_t<Type>::columns>([&result,
-                                                           &i](auto j) {
-          result &=
-              std::is_same_v<element_at<Type, i, j>, element_at<Type, 0, 0>>;
-        });
-      });
+//! @brief Element-wise operation checks over the distinct combinations of the
+//! row and column index types of the typed matrices.
+template <template <typename...> typename Operation, typename... Matrices>
+struct elementwise {
+  using operation = Operation<std::remove_cvref_t<Matrices>...>;
 
-      return result;
-    }());
+  static constexpr const auto &rows{distinct_positions<
+      typename std::remove_cvref_t<Matrices>::row_indexes...>};
+
+  static constexpr const auto &columns{distinct_positions<
+      typename std::remove_cvref_t<Matrices>::column_indexes...>};
+
+  static constexpr std::size_t count{rows.count * columns.count};
+
+  static constexpr std::array<bool, count> compatibles{
+      []<std::size_t... Positions>(std::index_sequence<Positions...>) {
+        return std::array<bool, count>{operation::template compatible<
+            rows.at[Positions / columns.count],
+            columns.at[Positions % columns.count]>...};
+      }(std::make_index_sequence<count>{})};
+
+  //! @brief The position of the first incompatible check, or the count if
+  //! none.
+  static constexpr std::size_t incompatible{first_false(compatibles)};
+};
+
+//! @brief Element-wise uniformity with the first element.
+template <typename Type> struct uniform {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{
+      std::is_same_v<element_at<Type, Row, Column>, element_at<Type, 0, 0>>};
+};
+
+//! @brief Whether all the elements of a typed matrix are of the same type.
+//!
+//! @details Checks one element per distinct combination of row and column
+//! index types, see `distinct_positions`. Evaluated once per typed matrix type.
+template <typename Type>
+constexpr bool is_uniform{elementwise<uniform, Type>::incompatible ==
+                          elementwise<uniform, Type>::count};
+
+template <typename Type>
+concept uniform_typed_matrix =
+    same_as_typed_matrix<Type> and is_uniform<std::remove_cvref_t<Type>>;
 
 template <typename Type>
 concept column_typed_matrix =
@@ -309,6 +733,211 @@ concept same_shape =
     (std::remove_cvref_t<Lhs>::rows == std::remove_cvref_t<Rhs>::rows) &&
     (std::remove_cvref_t<Lhs>::columns == std::remove_cvref_t<Rhs>::columns);
 
+//! @brief Concept of typed matrix shapes admitting a matrix product.
+//!
+//! @details Excludes singleton by singleton, an ordinary scalar product
+//! served by a dedicated, simpler overload.
+template <typename Lhs, typename Rhs>
+concept multipliable_shape =
+    same_as_typed_matrix<Lhs> and same_as_typed_matrix<Rhs> and
+    (std::remove_cvref_t<Lhs>::columns == std::remove_cvref_t<Rhs>::rows) and
+    (std::remove_cvref_t<Lhs>::columns > 1 or
+     std::remove_cvref_t<Lhs>::rows > 1 or
+     std::remove_cvref_t<Rhs>::columns > 1);
+
+//! @brief Per-term product checks of the `Lhs * Rhs` matrix product over the
+//! distinct combinations of the left-hand side row index types, the right-hand
+//! side column index types, and the terms index types of both sides.
+template <typename Lhs, typename Rhs> struct product_terms {
+  static constexpr const auto &rows{
+      distinct_positions<typename Lhs::row_indexes>};
+
+  static constexpr const auto &columns{
+      distinct_positions<typename Rhs::column_indexes>};
+
+  static constexpr const auto &terms{
+      distinct_positions<typename Lhs::column_indexes,
+                         typename Rhs::row_indexes>};
+
+  //! @brief Whether the term of the row-column converts to the type of the
+  //! row-column's first term.
+  template <std::size_t Row, std::size_t Column, std::size_t Term>
+  static constexpr bool convertible{std::is_convertible_v<
+      product<element_at<Lhs, Row, Term>, element_at<Rhs, Term, Column>>,
+      product<element_at<Lhs, Row, 0>, element_at<Rhs, 0, Column>>>};
+
+  static constexpr bool all_convertible{
+      []<std::size_t... Positions>(std::index_sequence<Positions...>) {
+        return (convertible<rows.at[Positions / terms.count / columns.count],
+                            columns.at[Positions / terms.count % columns.count],
+                            terms.at[Positions % terms.count]> and
+                ...);
+      }(std::make_index_sequence<rows.count * columns.count * terms.count>{})};
+};
+
+//! @brief Whether every per-term product of the `Lhs * Rhs` matrix product
+//! converts to the type of its row-column's first term, as required to sum
+//! them.
+//!
+//! @details Checks one term per distinct combination of row, column, and term
+//! index types, see `distinct_positions`.
+//!
+//! @pre `Lhs` and `Rhs` are `multipliable_shape`.
+template <typename Lhs, typename Rhs> constexpr bool are_terms_multipliable() {
+  return product_terms<std::remove_cvref_t<Lhs>,
+                       std::remove_cvref_t<Rhs>>::all_convertible;
+}
+
+//! @brief Concept of typed matrices whose per-term products can be summed
+//! into a matrix product result.
+template <typename Lhs, typename Rhs>
+concept multipliable_elements = are_terms_multipliable<Lhs, Rhs>();
+
+template <typename Lhs, typename Rhs>
+concept multipliable =
+    multipliable_shape<Lhs, Rhs> and multipliable_elements<Lhs, Rhs>;
+
+//! @brief Indexes of the typed matrix type shaped by the given row and column
+//! index types, without storage.
+template <typename RowIndexes, typename ColumnIndexes> struct indexes {
+  using row_indexes = RowIndexes;
+  using column_indexes = ColumnIndexes;
+  using row_list = type_list_t<row_indexes>;
+  using column_list = type_list_t<column_indexes>;
+};
+
+//! @brief Indexes of the `Lhs * Rhs` matrix product.
+//!
+//! @details The product's rows are the left-hand side rows scaled by its first
+//! column, its columns the right-hand side columns scaled by its first row.
+template <typename Lhs, typename Rhs>
+using product_indexes = indexes<
+    product<typename std::remove_cvref_t<Lhs>::row_indexes,
+            typename std::remove_cvref_t<Lhs>::column_list::template at<0>>,
+    product<typename std::remove_cvref_t<Rhs>::column_indexes,
+            typename std::remove_cvref_t<Rhs>::row_list::template at<0>>>;
+
+//! @brief The column vector view of a one-dimension typed matrix type.
+//!
+//! @details A row vector holds the elements of the column vector of swapped
+//! row and column indexes. The matrix-vector algorithms view their vectors as
+//! column vectors, whatever their storage orientation, to check and type their
+//! products. The view names the innermost backend, without storage of its own.
+template <typename Type> struct column_view {
+  using type = std::remove_cvref_t<Type>;
+};
+
+template <typename Type>
+  requires(std::remove_cvref_t<Type>::rows == 1 and
+           std::remove_cvref_t<Type>::columns > 1)
+struct column_view<Type> {
+  using type =
+      typed_matrix<innermost_t<typename std::remove_cvref_t<Type>::matrix>,
+                   typename std::remove_cvref_t<Type>::column_indexes,
+                   typename std::remove_cvref_t<Type>::row_indexes>;
+};
+
+template <typename Type> using column_view_t = column_view<Type>::type;
+
+//! @brief Element-wise addition compatibility.
+template <typename Lhs, typename Rhs> struct addable {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Lhs, Row, Column>>() +
+        std::declval<element_at<Rhs, Row, Column>>();
+  }};
+};
+
+//! @brief Element-wise subtraction compatibility.
+template <typename Lhs, typename Rhs> struct substractable {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Lhs, Row, Column>>() -
+        std::declval<element_at<Rhs, Row, Column>>();
+  }};
+};
+
+//! @brief Element-wise equality compatibility.
+template <typename Lhs, typename Rhs> struct comparable {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Lhs, Row, Column>>() ==
+        std::declval<element_at<Rhs, Row, Column>>();
+  }};
+};
+
+//! @brief Element-wise negation compatibility.
+template <typename Type> struct negatable {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{
+      requires { -std::declval<element_at<Type, Row, Column>>(); }};
+};
+
+//! @brief Element-wise assignment compatibility.
+template <typename Result, typename Value> struct assignable {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Result, Row, Column> &>() =
+        std::declval<element_at<Value, Row, Column>>();
+  }};
+};
+
+//! @brief Element-wise addition into a result compatibility.
+template <typename Result, typename Lhs, typename Rhs> struct addable_to {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Result, Row, Column> &>() =
+        std::declval<element_at<Lhs, Row, Column>>() +
+        std::declval<element_at<Rhs, Row, Column>>();
+  }};
+};
+
+//! @brief Element-wise subtraction into a result compatibility.
+template <typename Result, typename Lhs, typename Rhs> struct substractable_to {
+  template <std::size_t Row, std::size_t Column>
+  static constexpr bool compatible{requires {
+    std::declval<element_at<Result, Row, Column> &>() =
+        std::declval<element_at<Lhs, Row, Column>>() -
+        std::declval<element_at<Rhs, Row, Column>>();
+  }};
+};
+
+//! @brief Names the row and column indexes of an incompatible element in the
+//! diagnostic of its instantiation.
+template <typename Operation, std::size_t Row, std::size_t Column>
+constexpr bool incompatible_element() {
+  static_assert(Operation::template compatible<Row, Column>,
+                "The element types at the row and column indexes of this "
+                "instantiation are incompatible.");
+  return false;
+}
+
+//! @brief Whether the elements of the typed matrices are compatible for the
+//! element-wise operation.
+//!
+//! @details The operation is checked once per distinct combination of the
+//! matrices row index types by distinct combination of their column index
+//! types, rather than once per element. A few index types make for a few
+//! checks, whatever the sizes of the matrices. The first incompatible element,
+//! if any, is named by its row and column indexes in the diagnostic of the
+//! `incompatible_element` instantiation. Meant for the static assertions of
+//! the algorithms, not for constraints.
+template <template <typename...> typename Operation, typename... Matrices>
+constexpr bool elementwise_compatible() {
+  using checks = elementwise<Operation, Matrices...>;
+
+  if constexpr (checks::incompatible < checks::count) {
+    constexpr std::size_t position{checks::incompatible};
+
+    return incompatible_element<
+        typename checks::operation,
+        checks::rows.at[position / checks::columns.count],
+        checks::columns.at[position % checks::columns.count]>();
+  } else {
+    return true;
+  }
+}
+
 template <typename Type, std::size_t Size> struct tupler {
   template <typename = std::make_index_sequence<Size>> struct helper;
 
@@ -0,0 +1,105 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_BENCHMARK_HPP
+#define FCAROUGE_BENCHMARK_HPP
+
+//! @file
+//! @brief Machine-readable benchmark results support.
+
+#include <nanobench.h>
+
+#include <fstream>
+#include <string>
+
+namespace fcarouge::benchmark {
+//! @brief Machine-readable benchmark results formats.
+enum class format {
+  //! @brief Semicolon-separated values appended to `results.csv`.
+  csv,
+  //! @brief JSON lines appended to `results.json`.
+  json
+};
+
+//! @brief The results format selected by the `BENCHMARK_FORMAT` CMake cache
+//! variable.
+inline constexpr format output_format{format::FCAROUGE_BENCHMARK_FORMAT};
+
+//! @brief Record the results of a benchmark in the machine-readable format.
+//!
+//! @details One record per result, keyed by title, name, and size, with the
+//! median elapsed time in seconds, its median absolute percent error, and the
+//! median hardware performance counters per operation: instructions, CPU
+//! cycles, branch instructions, and branch misses. The counters are zero where
+//! nanobench cannot collect them, for example outside of Linux or without
+//! access to perf events. The last field is the overhead ratio of a typed
+//! benchmark over its untyped equivalent, zero for benchmarks without one. The
+//! records of successive runs are appended, the last record of a key is the
+//! most recent one. The `compare` tool diffs the records against a baseline.
+//!
+//! @param bench The benchmark with its results to record.
+//! @param size The size label of the benchmark, for example `16x16`.
+//! @param overhead The overhead ratio of the typed benchmark over its untyped
+//! equivalent, if any.
+inline void record(const ankerl::nanobench::Bench &bench,
+                   const std::string &size, double overhead = 0.) {
+  if constexpr (output_format == format::csv) {
+    std::ofstream results{"results.csv", std::ios::app};
+    bench.render(("{{#result}}\"{{title}}\";\"{{name}}\";\"" + size +
+                  "\";{{median(elapsed)}};"
+                  "{{medianAbsolutePercentError(elapsed)}};"
+                  "{{median(instructions)}};{{median(cpucycles)}};"
+                  "{{median(branchinstructions)}};{{median(branchmisses)}};" +
+                  std::to_string(overhead) + "\n{{/result}}")
+                     .c_str(),
+                 results);
+  } else {
+    std::ofstream results{"results.json", std::ios::app};
+    bench.render(("{{#result}}{\"title\": \"{{title}}\", \"name\": "
+                  "\"{{name}}\", \"size\": \"" +
+                  size +
+                  "\", \"median(elapsed)\": {{median(elapsed)}}, "
+                  "\"medianAbsolutePercentError(elapsed)\": "
+                  "{{medianAbsolutePercentError(elapsed)}}, "
+                  "\"median(instructions)\": {{median(instructions)}}, "
+                  "\"median(cpucycles)\": {{median(cpucycles)}}, "
+                  "\"median(branchinstructions)\": "
+                  "{{median(branchinstructions)}}, "
+                  "\"median(branchmisses)\": {{median(branchmisses)}}, "
+                  "\"overhead\": " +
+                  std::to_string(overhead) + "}\n{{/result}}")
+                     .c_str(),
+                 results);
+  }
+}
+} // namespace fcarouge::benchmark
+
+#endif // FCAROUGE_BENCHMARK_HPP
@@ -0,0 +1,110 @@
+#[[ Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> ]]
+
+# Verify the code generation of the typed kernels of a given object file.
+#
+# Run in script mode by the code generation tests. Each `typed_` function of the
+# object file is disassembled and compared against its `raw_` counterpart. The
+# instruction streams, including relocations, must be equivalent once the
+# addresses, function names, and local labels are normalized. Fails listing
+# both streams of the first mismatching pair.
+#
+# * OBJDUMP The object file disassembler.
+# * OBJECT The object file of the kernels compiled with function sections.
+
+cmake_minimum_required(VERSION "4.3")
+
+# Disassemble and normalize the instruction stream of a given function.
+function(disassemble OUTPUT FUNCTION)
+  execute_process(
+    COMMAND "${OBJDUMP}" --disassemble=${FUNCTION} --no-show-raw-insn
+            --reloc --wide "${OBJECT}"
+    OUTPUT_VARIABLE DISASSEMBLY
+    RESULTS_VARIABLE RESULT)
+  if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to disassemble ${FUNCTION} of ${OBJECT}.")
+  endif()
+
+  string(REPLACE ";" "," DISASSEMBLY "${DISASSEMBLY}")
+  string(REPLACE "\n" ";" LINES "${DISASSEMBLY}")
+  set(INSTRUCTIONS "")
+  foreach(LINE IN LISTS LINES)
+    if(NOT LINE MATCHES "^[ \t]*[0-9a-f]+:[ \t]+(.*)$")
+      continue()
+    endif()
+    set(INSTRUCTION "${CMAKE_MATCH_1}")
+    string(REGEX REPLACE "[ \t]*#.*$" "" INSTRUCTION "${INSTRUCTION}")
+    string(REGEX REPLACE "<(typed|raw)_[A-Za-z0-9_]+" "<kernel" INSTRUCTION
+                         "${INSTRUCTION}")
+    string(REGEX REPLACE "\\.L[A-Za-z]*[0-9]+" ".L" INSTRUCTION
+                         "${INSTRUCTION}")
+    string(REGEX REPLACE "[ \t]+" " " INSTRUCTION "${INSTRUCTION}")
+    list(APPEND INSTRUCTIONS "${INSTRUCTION}")
+  endforeach()
+
+  if(NOT INSTRUCTIONS)
+    message(FATAL_ERROR "No instruction for ${FUNCTION} in ${OBJECT}.")
+  endif()
+
+  set(${OUTPUT}
+      "${INSTRUCTIONS}"
+      PARENT_SCOPE)
+endfunction(disassemble)
+
+execute_process(
+  COMMAND "${OBJDUMP}" --syms "${OBJECT}"
+  OUTPUT_VARIABLE SYMBOLS
+  RESULTS_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "Failed to read the symbols of ${OBJECT}.")
+endif()
+
+string(REGEX MATCHALL "[ \t]typed_[A-Za-z0-9_]+\n" KERNELS "${SYMBOLS}")
+list(TRANSFORM KERNELS REPLACE "^[ \t]typed_([A-Za-z0-9_]+)\n$" "\\1")
+list(REMOVE_DUPLICATES KERNELS)
+
+if(NOT KERNELS)
+  message(FATAL_ERROR "No typed kernel in ${OBJECT}.")
+endif()
+
+foreach(KERNEL IN LISTS KERNELS)
+  disassemble(TYPED "typed_${KERNEL}")
+  disassemble(RAW "raw_${KERNEL}")
+  if(NOT TYPED STREQUAL RAW)
+    list(JOIN TYPED "\n  " TYPED)
+    list(JOIN RAW "\n  " RAW)
+    message(
+      FATAL_ERROR
+        "The typed ${KERNEL} kernel code generation differs from its raw "
+        "counterpart.\ntyped_${KERNEL}:\n  ${TYPED}\nraw_${KERNEL}:\n  ${RAW}")
+  endif()
+  message(STATUS "The typed ${KERNEL} kernel code generation is equivalent.")
+endforeach()
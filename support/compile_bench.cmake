@@ -0,0 +1,135 @@
+#[[ Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> ]]
+
+# Measure the compilation of a given compile-time benchmark object target.
+#
+# Run in script mode by the compile-time benchmark tests, appending one record
+# of semicolon-separated values to the results file: the title and size of the
+# benchmark, the wall time of the compilation in seconds, the peak resident set
+# size of the compiler in bytes, the Clang `-ftime-trace` totals in seconds of
+# the frontend, the backend, the class template instantiations, and the
+# function template instantiations, the size of the object file in bytes, and
+# the counts of distinct `element_at`, `product`, and `quotient` library
+# metafunctions instantiations. The values not measured on a platform are zero.
+#
+# * BINARY_DIR The build tree.
+# * CONFIG The build configuration.
+# * TARGET The compile-time benchmark object target.
+# * OBJECT The object file of the target.
+# * RSS The file of peak resident set size in kilobytes written by the compiler
+#   launcher, if any.
+# * DIAGNOSTICS The object target of the benchmark compiled with the library
+#   instantiation diagnostics, if any.
+# * DIAGNOSTICS_OBJECT The object file of the diagnostics target, if any.
+# * TITLE The title of the benchmark.
+# * SIZE The size of the benchmark.
+# * RESULTS The results file to append the record to.
+
+cmake_minimum_required(VERSION "4.3")
+
+string(REGEX REPLACE "\\.[^.]*$" ".json" TRACE "${OBJECT}")
+file(REMOVE "${OBJECT}" "${RSS}" "${TRACE}")
+
+string(TIMESTAMP START "%s%f" UTC)
+execute_process(
+  COMMAND "${CMAKE_COMMAND}" --build "${BINARY_DIR}" --config "${CONFIG}"
+          --target "${TARGET}" RESULTS_VARIABLE RESULT)
+string(TIMESTAMP STOP "%s%f" UTC)
+
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "Failed to compile ${TARGET}.")
+endif()
+
+math(EXPR WALL_US "${STOP} - ${START}")
+
+set(PEAK_RSS 0)
+if(RSS AND EXISTS "${RSS}")
+  file(STRINGS "${RSS}" RSS_KB REGEX "^[0-9]+$")
+  math(EXPR PEAK_RSS "${RSS_KB} * 1024")
+endif()
+
+set(Frontend_US 0)
+set(Backend_US 0)
+set(InstantiateClass_US 0)
+set(InstantiateFunction_US 0)
+if(EXISTS "${TRACE}")
+  file(READ "${TRACE}" TRACE_CONTENT)
+  string(REGEX MATCHALL "\"dur\":[0-9]+,\"name\":\"Total [A-Za-z]+\"" TOTALS
+               "${TRACE_CONTENT}")
+  foreach(TOTAL IN LISTS TOTALS)
+    string(REGEX REPLACE "\"dur\":([0-9]+),\"name\":\"Total ([A-Za-z]+)\""
+                         "\\2_US;\\1" TOTAL "${TOTAL}")
+    list(GET TOTAL 0 NAME)
+    list(GET TOTAL 1 DURATION)
+    set(${NAME} "${DURATION}")
+  endforeach()
+endif()
+
+# Format a duration in microseconds as seconds.
+function(seconds OUTPUT MICROSECONDS)
+  math(EXPR WHOLE "${MICROSECONDS} / 1000000")
+  math(EXPR FRACTION "${MICROSECONDS} % 1000000 + 1000000")
+  string(SUBSTRING "${FRACTION}" 1 6 FRACTION)
+  set(${OUTPUT}
+      "${WHOLE}.${FRACTION}"
+      PARENT_SCOPE)
+endfunction(seconds)
+
+file(SIZE "${OBJECT}" OBJECT_SIZE)
+
+# Count the instantiation markers emitted once per distinct instantiation of
+# the library metafunctions, see `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS`.
+include("${CMAKE_CURRENT_LIST_DIR}/instantiations.cmake")
+set(element_at_COUNT 0)
+set(product_COUNT 0)
+set(quotient_COUNT 0)
+if(DIAGNOSTICS)
+  execute_process(
+    COMMAND "${CMAKE_COMMAND}" --build "${BINARY_DIR}" --config "${CONFIG}"
+            --target "${DIAGNOSTICS}" RESULTS_VARIABLE RESULT)
+  if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to compile ${DIAGNOSTICS}.")
+  endif()
+
+  count_instantiations("${DIAGNOSTICS_OBJECT}")
+endif()
+
+seconds(WALL "${WALL_US}")
+seconds(FRONTEND "${Frontend_US}")
+seconds(BACKEND "${Backend_US}")
+seconds(INSTANTIATE_CLASS "${InstantiateClass_US}")
+seconds(INSTANTIATE_FUNCTION "${InstantiateFunction_US}")
+
+file(
+  APPEND "${RESULTS}"
+  "\"${TITLE}\";\"${SIZE}\";${WALL};${PEAK_RSS};${FRONTEND};${BACKEND};"
+  "${INSTANTIATE_CLASS};${INSTANTIATE_FUNCTION};${OBJECT_SIZE};"
+  "${element_at_COUNT};${product_COUNT};${quotient_COUNT}\n")
@@ -0,0 +1,55 @@
+#[[ Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> ]]
+
+# Verify the instantiation diagnostics markers of a given object file.
+#
+# Run in script mode by the diagnostics tests. The object file, compiled with
+# the `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS` instantiation diagnostics,
+# must emit and count at least one marker of each of the `element_at`,
+# `product`, and `quotient` library metafunctions. Fails listing the counts
+# otherwise.
+#
+# * OBJECT The object file compiled with the instantiation diagnostics.
+
+cmake_minimum_required(VERSION "4.3")
+
+include("${CMAKE_CURRENT_LIST_DIR}/instantiations.cmake")
+
+count_instantiations("${OBJECT}")
+
+message(STATUS "element_at: ${element_at_COUNT}, product: ${product_COUNT}, "
+               "quotient: ${quotient_COUNT}")
+
+foreach(METAFUNCTION IN ITEMS "element_at" "product" "quotient")
+  if(NOT ${METAFUNCTION}_COUNT GREATER 0)
+    message(FATAL_ERROR "No ${METAFUNCTION} marker in ${OBJECT}.")
+  endif()
+endforeach()
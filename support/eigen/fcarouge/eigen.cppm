@@ -0,0 +1,58 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Typed linear algebra Eigen plug-in named module.
+//!
+//! @details Re-exports the library module along with the Eigen matrix aliases
+//! and the argument-dependent lookup overloads of the Eigen types.
+
+module;
+
+#include "fcarouge/eigen.hpp"
+
+export module fcarouge.typed_linear_algebra.eigen;
+
+export import fcarouge.typed_linear_algebra;
+
+export namespace fcarouge::eigen {
+using fcarouge::eigen::column_vector;
+using fcarouge::eigen::derived_from_eigen_base;
+using fcarouge::eigen::is_eigen;
+using fcarouge::eigen::matrix;
+using fcarouge::eigen::row_vector;
+using fcarouge::eigen::statically_sized;
+} // namespace fcarouge::eigen
+
+export namespace Eigen {
+using Eigen::get;
+using Eigen::operator/;
+} // namespace Eigen
@@ -0,0 +1,64 @@
+#[[ Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> ]]
+
+# Count the library metafunctions instantiation markers of a given object file.
+#
+# Each distinct instantiation of the `element_at`, `product`, and `quotient`
+# library metafunctions emits its marker string once in the object file when
+# compiled with the `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS` instantiation
+# diagnostics. Sets the `element_at_COUNT`, `product_COUNT`, and
+# `quotient_COUNT` variables of the caller.
+#
+# * OBJECT The object file compiled with the instantiation diagnostics.
+function(count_instantiations OBJECT)
+  set(METAFUNCTIONS "element_at" "product" "quotient")
+  foreach(METAFUNCTION IN LISTS METAFUNCTIONS)
+    set(${METAFUNCTION}_COUNT 0)
+  endforeach()
+
+  file(STRINGS "${OBJECT}" MARKERS REGEX "fcarouge[.]typed_linear_algebra[.]")
+  foreach(MARKER IN LISTS MARKERS)
+    string(REGEX MATCHALL "fcarouge[.]typed_linear_algebra[.][a-z_]+" NAMES
+                 "${MARKER}")
+    foreach(NAME IN LISTS NAMES)
+      string(REGEX REPLACE "^.*[.]" "" METAFUNCTION "${NAME}")
+      if(METAFUNCTION IN_LIST METAFUNCTIONS)
+        math(EXPR ${METAFUNCTION}_COUNT "${${METAFUNCTION}_COUNT} + 1")
+      endif()
+    endforeach()
+  endforeach()
+
+  foreach(METAFUNCTION IN LISTS METAFUNCTIONS)
+    set(${METAFUNCTION}_COUNT
+        "${${METAFUNCTION}_COUNT}"
+        PARENT_SCOPE)
+  endforeach()
+endfunction(count_instantiations)
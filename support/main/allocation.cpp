@@ -0,0 +1,92 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Counting replacement of the global allocation functions.
+//!
+//! @details The allocations are accounted per thread. The array, nothrow, and
+//! sized forms of the allocation functions forward to the replaced forms by
+//! default.
+
+#include "fcarouge/allocation.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local fcarouge::allocations thread_allocations;
+
+void *allocate(std::size_t size, std::size_t alignment) {
+  ++thread_allocations.count;
+  thread_allocations.bytes += size;
+
+  // Zero-size allocations must return distinct non-null pointers.
+  const std::size_t rounded{
+      size == 0 ? alignment : (size + alignment - 1) / alignment * alignment};
+#if defined(_MSC_VER)
+  void *pointer{_aligned_malloc(rounded, alignment)};
+#else
+  void *pointer{std::aligned_alloc(alignment, rounded)};
+#endif
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return pointer;
+}
+
+void deallocate(void *pointer) noexcept {
+#if defined(_MSC_VER)
+  _aligned_free(pointer);
+#else
+  std::free(pointer);
+#endif
+}
+} // namespace
+
+namespace fcarouge {
+allocations allocated() noexcept { return thread_allocations; }
+} // namespace fcarouge
+
+void *operator new(std::size_t size) {
+  return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
@@ -0,0 +1,74 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_ALLOCATION_HPP
+#define FCAROUGE_ALLOCATION_HPP
+
+//! @file
+//! @brief Heap allocation accounting support.
+//!
+//! @details The replaceable global allocation functions are replaced by
+//! counting ones when linking the `typed_linear_algebra_allocation` library.
+
+#include <cstddef>
+
+namespace fcarouge {
+//! @brief Heap allocations statistics.
+struct allocations {
+  //! @brief Number of allocations.
+  std::size_t count{0};
+
+  //! @brief Number of bytes allocated.
+  std::size_t bytes{0};
+
+  [[nodiscard]] constexpr bool
+  operator==(const allocations &other) const = default;
+};
+
+//! @brief Heap allocations of the current thread since its start.
+[[nodiscard]] allocations allocated() noexcept;
+
+//! @brief Heap allocations of the current thread during the invocation of a
+//! function.
+//!
+//! @param function The function to invoke and account for.
+//!
+//! @return The number and bytes of heap allocations of the invocation.
+[[nodiscard]] allocations allocations_of(auto &&function) {
+  const allocations before{allocated()};
+  function();
+  const allocations after{allocated()};
+
+  return {after.count - before.count, after.bytes - before.bytes};
+}
+} // namespace fcarouge
+
+#endif // FCAROUGE_ALLOCATION_HPP
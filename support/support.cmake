@@ -97,27 +97,119 @@ function(fail NAME)
   endforeach()
 endfunction(fail)
 
+# Add a given code generation test.
+#
+# * NAME The name of the test file without extension.
+# * BACKENDS Optional list of backends to use against the test.
+#
+# The test file is compiled optimized, with function sections, and its typed
+# kernels are compared against their raw counterparts in the disassembly, see
+# `codegen.cmake`. The automatic variables are left uninitialized for the
+# hardening options not to weigh on one side of the comparison only. Requires a
+# GNU-compatible compiler and disassembler.
+function(codegen NAME)
+  set(multiValueArgs BACKENDS)
+  cmake_parse_arguments(PARSE_ARGV 0 TEST "" "${oneValueArgs}"
+                        "${multiValueArgs}")
+
+  get_filename_component(CALLER "${CMAKE_CURRENT_SOURCE_DIR}" NAME)
+
+  if(NOT CMAKE_OBJDUMP OR CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+    return()
+  endif()
+
+  foreach(BACKEND IN ITEMS ${TEST_BACKENDS})
+    add_library(typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver OBJECT
+                "${NAME}.cpp")
+    target_link_libraries(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver
+      PRIVATE tlinalg typed_linear_algebra_options
+              typed_linear_algebra_${BACKEND})
+    target_compile_options(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver
+      PRIVATE "-DNDEBUG" "-O2" "-ffunction-sections"
+              "-ftrivial-auto-var-init=uninitialized")
+    add_test(
+      NAME typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}
+      COMMAND
+        ${CMAKE_COMMAND} -D "OBJDUMP=${CMAKE_OBJDUMP}" -D
+        "OBJECT=$<TARGET_OBJECTS:typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver>"
+        -P "${PROJECT_SOURCE_DIR}/support/codegen.cmake")
+  endforeach()
+endfunction(codegen)
+
+# Add a given instantiation diagnostics test.
+#
+# * NAME The name of the test file without extension.
+# * BACKENDS Optional list of backends to use against the test.
+#
+# The test file is compiled with the `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS`
+# instantiation diagnostics of the library enabled, and its object file must
+# emit the markers of each library metafunction, see `diagnostics.cmake`.
+# Requires GCC or Clang for the markers.
+function(diagnostics NAME)
+  set(multiValueArgs BACKENDS)
+  cmake_parse_arguments(PARSE_ARGV 0 TEST "" "${oneValueArgs}"
+                        "${multiValueArgs}")
+
+  get_filename_component(CALLER "${CMAKE_CURRENT_SOURCE_DIR}" NAME)
+
+  if(NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang|GNU")
+    return()
+  endif()
+
+  foreach(BACKEND IN ITEMS ${TEST_BACKENDS})
+    add_library(typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver OBJECT
+                "${NAME}.cpp")
+    target_link_libraries(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver
+      PRIVATE tlinalg typed_linear_algebra_options
+              typed_linear_algebra_${BACKEND})
+    target_compile_definitions(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver
+      PRIVATE "FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS")
+    add_test(
+      NAME typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}
+      COMMAND
+        ${CMAKE_COMMAND} -D
+        "OBJECT=$<TARGET_OBJECTS:typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_driver>"
+        -P "${PROJECT_SOURCE_DIR}/support/diagnostics.cmake")
+  endforeach()
+endfunction(diagnostics)
+
 # Add a given benchmark.
 #
 # * NAME The name of the benchmark file without extension.
-# * SIZE The size factor under measurement.
+# * SIZE The size factor under measurement. Multiple size factors are separated
+#   by an `x`, for example `9x3`, and made available to the benchmark file as
+#   the comma separated `SIZES` template arguments list.
 # * BACKENDS Optional list of backends to use against the benchmark.
+# * LIBRARIES Optional list of additional libraries to link the benchmark with.
+#
+# The benchmarks append their results to `results.txt` as markdown table rows
+# and to the machine-readable `results.csv` or `results.json` selected by the
+# `BENCHMARK_FORMAT` cache variable. The benchmark tests are labeled `bench` and
+# set up the `typed_linear_algebra_bench` fixture required by the tools
+# consuming their results.
 function(bench NAME SIZE)
-  set(multiValueArgs BACKENDS)
+  set(multiValueArgs BACKENDS LIBRARIES)
   cmake_parse_arguments(PARSE_ARGV 0 TEST "" "${oneValueArgs}"
                         "${multiValueArgs}")
 
   get_filename_component(CALLER "${CMAKE_CURRENT_SOURCE_DIR}" NAME)
 
+  string(REPLACE "x" ", " SIZES "${SIZE}")
+
   foreach(BACKEND IN ITEMS ${TEST_BACKENDS})
-    configure_file("${NAME}.cpp" "${NAME}_${SIZE}.cpp")
+    configure_file("${NAME}.cpp" "${NAME}_${BACKEND}_${SIZE}.cpp")
     add_executable(
       typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench_driver
-      "${NAME}_${SIZE}.cpp")
+      "${NAME}_${BACKEND}_${SIZE}.cpp")
     target_link_libraries(
       typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench_driver
       PRIVATE tlinalg typed_linear_algebra_options
-              typed_linear_algebra_${BACKEND} nanobench::nanobench)
+              typed_linear_algebra_${BACKEND} typed_linear_algebra_benchmark
+              nanobench::nanobench ${TEST_LIBRARIES})
     separate_arguments(TEST_COMMAND UNIX_COMMAND $ENV{COMMAND})
     add_test(
       NAME typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench
@@ -125,9 +217,87 @@ function(bench NAME SIZE)
         ${TEST_COMMAND}
         $<TARGET_FILE:typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench_driver>
     )
-    if(DEFINED DEPENDENCIES)
-      list(APPEND ${DEPENDENCIES}
-           "typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench")
-    endif()
+    set_tests_properties(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_bench
+      PROPERTIES FIXTURES_SETUP "typed_linear_algebra_bench" LABELS "bench")
   endforeach()
 endfunction(bench)
+
+# Add a given compile-time benchmark.
+#
+# * NAME The name of the benchmark file without extension.
+# * SIZE The size factor under measurement, available to the benchmark file as
+#   the `SIZE` template argument.
+# * BACKENDS Optional list of backends to use against the benchmark.
+#
+# The benchmark file is compiled, not linked nor run, by its test. The test
+# measures the compilation and appends its record to `compile.csv`, see
+# `compile_bench.cmake`. The compile-time benchmark tests are labeled `compile`
+# and set up the `typed_linear_algebra_bench` fixture required by the tools
+# consuming their results.
+#
+# With GCC and Clang, the benchmark file is also compiled, unmeasured, with the
+# `FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS` instantiation diagnostics of the
+# library enabled, to count its metafunctions instantiations.
+function(compile_bench NAME SIZE)
+  set(multiValueArgs BACKENDS)
+  cmake_parse_arguments(PARSE_ARGV 0 TEST "" "${oneValueArgs}"
+                        "${multiValueArgs}")
+
+  get_filename_component(CALLER "${CMAKE_CURRENT_SOURCE_DIR}" NAME)
+
+  if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+    find_program(TIME_COMMAND "time" PATHS "/usr/bin" NO_DEFAULT_PATH)
+  endif()
+
+  foreach(BACKEND IN ITEMS ${TEST_BACKENDS})
+    set(TARGET
+        "typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_compile_driver"
+    )
+    set(RSS "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}.rss")
+    configure_file("${NAME}.cpp" "${NAME}_${BACKEND}_${SIZE}.cpp")
+    add_library(${TARGET} OBJECT "${NAME}_${BACKEND}_${SIZE}.cpp")
+    target_link_libraries(
+      ${TARGET} PRIVATE tlinalg typed_linear_algebra_options
+                        typed_linear_algebra_${BACKEND})
+    set_target_properties(${TARGET} PROPERTIES EXCLUDE_FROM_ALL TRUE)
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
+      target_compile_options(${TARGET} PRIVATE "-ftime-trace")
+    endif()
+    if(TIME_COMMAND)
+      set_target_properties(
+        ${TARGET} PROPERTIES CXX_COMPILER_LAUNCHER
+                             "${TIME_COMMAND};--format=%M;--output=${RSS}")
+    else()
+      set(RSS "")
+    endif()
+    set(DIAGNOSTICS "")
+    set(DIAGNOSTICS_OBJECT "")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang|GNU")
+      set(DIAGNOSTICS "${TARGET}_diagnostics")
+      add_library(${DIAGNOSTICS} OBJECT "${NAME}_${BACKEND}_${SIZE}.cpp")
+      target_link_libraries(
+        ${DIAGNOSTICS} PRIVATE tlinalg typed_linear_algebra_options
+                               typed_linear_algebra_${BACKEND})
+      target_compile_definitions(
+        ${DIAGNOSTICS} PRIVATE "FCAROUGE_TYPED_LINEAR_ALGEBRA_DIAGNOSTICS")
+      set_target_properties(${DIAGNOSTICS} PROPERTIES EXCLUDE_FROM_ALL TRUE)
+      set(DIAGNOSTICS_OBJECT "$<TARGET_OBJECTS:${DIAGNOSTICS}>")
+    endif()
+    add_test(
+      NAME typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_compile
+      COMMAND
+        ${CMAKE_COMMAND} -D "BINARY_DIR=${CMAKE_BINARY_DIR}" -D
+        "CONFIG=$<CONFIG>" -D "TARGET=${TARGET}" -D
+        "OBJECT=$<TARGET_OBJECTS:${TARGET}>" -D "RSS=${RSS}" -D
+        "DIAGNOSTICS=${DIAGNOSTICS}" -D
+        "DIAGNOSTICS_OBJECT=${DIAGNOSTICS_OBJECT}" -D
+        "TITLE=${BACKEND} ${NAME}" -D "SIZE=${SIZE}" -D
+        "RESULTS=${CMAKE_CURRENT_BINARY_DIR}/compile.csv" -P
+        "${PROJECT_SOURCE_DIR}/support/compile_bench.cmake")
+    set_tests_properties(
+      typed_linear_algebra_${BACKEND}_${CALLER}_${NAME}_${SIZE}_compile
+      PROPERTIES FIXTURES_SETUP "typed_linear_algebra_bench" LABELS "compile"
+                 RUN_SERIAL TRUE)
+  endforeach()
+endfunction(compile_bench)
@@ -0,0 +1,68 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Typed linear algebra mp-units plug-in named module.
+//!
+//! @details Re-exports the library module along with the unit symbols, the
+//! quantity aliases, and the quantity element caster specializations.
+
+module;
+
+#include "fcarouge/typed_linear_algebra.hpp"
+#include "fcarouge/unit.hpp"
+
+export module fcarouge.typed_linear_algebra.unit;
+
+export import fcarouge.typed_linear_algebra;
+
+export namespace fcarouge {
+using fcarouge::A;
+using fcarouge::acceleration;
+using fcarouge::get;
+using fcarouge::h;
+using fcarouge::height;
+using fcarouge::km;
+using fcarouge::m;
+using fcarouge::m2;
+using fcarouge::m3;
+using fcarouge::m4;
+using fcarouge::mol;
+using fcarouge::N;
+using fcarouge::position;
+using fcarouge::quantity_element_typed_matrix;
+using fcarouge::s;
+using fcarouge::s2;
+using fcarouge::s3;
+using fcarouge::s4;
+using fcarouge::undecomposed_tuple_like_quantity;
+using fcarouge::velocity;
+} // namespace fcarouge
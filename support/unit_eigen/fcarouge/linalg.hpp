@@ -50,21 +50,21 @@ namespace fcarouge {
 //! @brief Quantity matrix with mp-units and Eigen implementations.
 template <typename Representation, typename RowIndexes, typename ColumnIndexes>
 using matrix =
-    typed_matrix<Eigen::Matrix<Representation, std::tuple_size_v<RowIndexes>,
-                               std::tuple_size_v<ColumnIndexes>>,
+    typed_matrix<Eigen::Matrix<Representation, tla::size_of<RowIndexes>,
+                               tla::size_of<ColumnIndexes>>,
                  RowIndexes, ColumnIndexes>;
 
 //! @brief Quantity column vector with mp-units and Eigen implementations.
 template <typename Representation, typename... Types>
-using column_vector =
-    typed_column_vector<eigen::column_vector<Representation, sizeof...(Types)>,
-                        Types...>;
+using column_vector = typed_column_vector<
+    eigen::column_vector<Representation, tla::size_of<std::tuple<Types...>>>,
+    Types...>;
 
 //! @brief Quantity row vector with mp-units and Eigen implementations.
 template <typename Representation, typename... Types>
-using row_vector =
-    typed_row_vector<eigen::row_vector<Representation, sizeof...(Types)>,
-                     Types...>;
+using row_vector = typed_row_vector<
+    eigen::row_vector<Representation, tla::size_of<std::tuple<Types...>>>,
+    Types...>;
 } // namespace fcarouge
 
 // Just like Eigen, the fcarouge::typed_matrix
@@ -46,20 +46,24 @@ namespace fcarouge {
 template <typename Representation, typename RowIndexes, typename ColumnIndexes>
 using matrix = typed_matrix<
     std::mdspan<Representation,
-                std::extents<std::size_t, std::tuple_size_v<RowIndexes>,
-                             std::tuple_size_v<ColumnIndexes>>>,
+                std::extents<std::size_t, tla::size_of<RowIndexes>,
+                             tla::size_of<ColumnIndexes>>>,
     RowIndexes, ColumnIndexes>;
 
 //! @brief Quantity column vector with mp-units and Eigen implementations.
 template <typename Representation, typename... Types>
 using column_vector = typed_column_vector<
-    std::mdspan<Representation, std::extents<std::size_t, sizeof...(Types), 1>>,
+    std::mdspan<Representation,
+                std::extents<std::size_t, tla::size_of<std::tuple<Types...>>,
+                             1>>,
     Types...>;
 
 //! @brief Quantity row vector with mp-units and Eigen implementations.
 template <typename Representation, typename... Types>
 using row_vector = typed_row_vector<
-    std::mdspan<Representation, std::extents<std::size_t, 1, sizeof...(Types)>>,
+    std::mdspan<Representation,
+                std::extents<std::size_t, 1,
+                             tla::size_of<std::tuple<Types...>>>>,
     Types...>;
 } // namespace fcarouge
 
@@ -0,0 +1,74 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/allocation.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the fixed-size typed operations do not allocate.
+[[maybe_unused]] const auto test{[] -> int {
+  const matrix<double, 2, 3> a{{1., 2., 3.}, {4., 5., 6.}};
+  const matrix<double, 2, 3> b{{7., 8., 9.}, {10., 11., 12.}};
+  const matrix<double, 3, 2> c{{1., 2.}, {3., 4.}, {5., 6.}};
+  const column_vector<double, 3> x{1., 2., 3.};
+  matrix<double, 2, 3> r{a};
+
+  assert((allocations_of([&] { r = a; }) == allocations{}));
+  assert((allocations_of([&] { r = a + b; }) == allocations{}));
+  assert((allocations_of([&] { r = a - b; }) == allocations{}));
+  assert((allocations_of([&] { r = -a; }) == allocations{}));
+  assert((allocations_of([&] { r = a * 2.; }) == allocations{}));
+  assert((allocations_of([&] { r = 2. * a; }) == allocations{}));
+  assert((allocations_of([&] { r = a / 2.; }) == allocations{}));
+  assert((allocations_of([&] { r.at<1, 2>(a.at<0, 1>()); }) == allocations{}));
+  assert((allocations_of([&] { r(1, 2) = a(0, 1); }) == allocations{}));
+  assert((allocations_of([&] { r[1, 2] = a[0, 1]; }) == allocations{}));
+  assert((allocations_of([&] {
+            const matrix<double, 2, 2> p{a * c};
+            assert((p.at<0, 0>() == 22.));
+          }) == allocations{}));
+  assert((allocations_of([&] {
+            const column_vector<double, 2> y{a * x};
+            assert((y.at<1>() == 32.));
+          }) == allocations{}));
+  assert((allocations_of([&] {
+            const matrix<double, 3, 2> aᵀ{transposed(a)};
+            assert((aᵀ.at<2, 0>() == 3.));
+          }) == allocations{}));
+  assert((allocations_of([&] { assert((r != b)); }) == allocations{}));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
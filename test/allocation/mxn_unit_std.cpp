@@ -0,0 +1,94 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/allocation.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <mdspan>
+#include <tuple>
+
+namespace fcarouge::test {
+using representation = double;
+
+template <auto QuantityReference>
+using quantity = mp_units::quantity<QuantityReference, representation>;
+
+namespace {
+//! @test Verifies the typed algorithms over borrowed storage do not allocate.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = quantity<mp_units::isq::length[m]>;
+  using volume = quantity<mp_units::isq::volume[m3]>;
+  using indexes = std::tuple<length, length>;
+
+  double storage_a[4]{};
+  double storage_b[4]{};
+  double storage_r[4]{};
+  double storage_x[2]{};
+  double storage_y[2]{};
+
+  std::mdspan span_a{&storage_a[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_b{&storage_b[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_r{&storage_r[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_x{&storage_x[0], std::extents<std::size_t, 2, 1>{}};
+  std::mdspan span_y{&storage_y[0], std::extents<std::size_t, 2, 1>{}};
+
+  matrix<representation, indexes, indexes> a{span_a};
+  matrix<representation, indexes, indexes> b{span_b};
+  matrix<representation, indexes, indexes> r{span_r};
+  column_vector<representation, length, length> x{span_x};
+  column_vector<representation, volume, volume> y{span_y};
+
+  assert((allocations_of([&] {
+            a.at<0, 0>(1. * m2);
+            a.at<0, 1>(2. * m2);
+            a.at<1, 0>(3. * m2);
+            a.at<1, 1>(4. * m2);
+            b.at<0, 0>(5. * m2);
+            b.at<0, 1>(6. * m2);
+            b.at<1, 0>(7. * m2);
+            b.at<1, 1>(8. * m2);
+            x.at<0>(5. * m);
+            x.at<1>(6. * m);
+          }) == allocations{}));
+  assert((allocations_of([&] { add(a, b, r); }) == allocations{}));
+  assert((r.at<1, 1>() == 12. * m2));
+  assert((allocations_of([&] { scale(2., r); }) == allocations{}));
+  assert((r.at<1, 1>() == 24. * m2));
+  assert((allocations_of([&] { matrix_vector_product(a, x, y); }) ==
+          allocations{}));
+  assert((y.at<1>() == 39. * m3));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
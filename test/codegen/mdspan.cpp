@@ -0,0 +1,95 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+
+//! @file
+//! @brief Typed and raw `std::mdspan` kernel pairs for code generation
+//! comparison.
+//!
+//! @details Each `typed_` kernel must compile to the same instruction stream
+//! as its `raw_` counterpart. The C language linkage keeps the symbol names
+//! unmangled for the disassembly comparison.
+
+namespace fcarouge::test {
+namespace {
+using raw_square = std::mdspan<double, std::extents<std::size_t, 4, 4>>;
+using raw_column = std::mdspan<double, std::extents<std::size_t, 4, 1>>;
+using typed_square =
+    matrix<double, typed_linear_algebra_internal::tuple_n_type<double, 4>,
+           typed_linear_algebra_internal::tuple_n_type<double, 4>>;
+using typed_column =
+    matrix<double, typed_linear_algebra_internal::tuple_n_type<double, 4>,
+           typed_linear_algebra_internal::tuple_n_type<double, 1>>;
+} // namespace
+
+extern "C" {
+//! @test Compile-time indexed read.
+double raw_at(raw_square m) { return m(1, 2); }
+double typed_at(typed_square m) { return m.at<1, 2>(); }
+
+//! @test Runtime indexed read.
+double raw_read(raw_square m, std::size_t i, std::size_t j) { return m(i, j); }
+double typed_read(typed_square m, std::size_t i, std::size_t j) {
+  return m(i, j);
+}
+
+//! @test Runtime indexed write.
+void raw_write(raw_square m, std::size_t i, std::size_t j, double value) {
+  m(i, j) = value;
+}
+void typed_write(typed_square m, std::size_t i, std::size_t j, double value) {
+  m(i, j) = value;
+}
+
+//! @test Runtime subscripted vector read.
+double raw_subscript(raw_column v, std::size_t i) { return v(i, 0); }
+double typed_subscript(typed_column v, std::size_t i) { return v[i]; }
+
+//! @test Matrix addition.
+void raw_add(raw_square a, raw_square b, raw_square r) {
+  std::linalg::add(a, b, r);
+}
+void typed_add(typed_square a, typed_square b, typed_square r) {
+  add(a, b, r);
+}
+
+//! @test Matrix product.
+void raw_product(raw_square a, raw_square b, raw_square r) {
+  std::linalg::matrix_product(a, b, r);
+}
+void typed_product(typed_square a, typed_square b, typed_square r) {
+  matrix_product(a, b, r);
+}
+}
+} // namespace fcarouge::test
@@ -0,0 +1,89 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+using representation = double;
+
+template <auto QuantityReference>
+using quantity = mp_units::quantity<QuantityReference, representation>;
+
+namespace {
+//! @test Verifies the compound assignment operators update the typed matrix
+//! in place with heterogeneous types.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = quantity<mp_units::isq::length[m]>;
+  using area = quantity<mp_units::isq::area[m2]>;
+
+  column_vector<representation, length, area> x{1. * m, 2. * m2};
+  const column_vector<representation, length, area> y{3. * m, 4. * m2};
+
+  x += y;
+
+  assert(4. * m == x.at<0>());
+  assert(6. * m2 == x.at<1>());
+
+  x -= y + y;
+
+  assert(-2. * m == x.at<0>());
+  assert(-2. * m2 == x.at<1>());
+
+  x *= 3.;
+
+  assert(-6. * m == x.at<0>());
+  assert(-6. * m2 == x.at<1>());
+
+  x /= 2.;
+
+  assert(-3. * m == x.at<0>());
+  assert(-3. * m2 == x.at<1>());
+
+  matrix<representation, std::tuple<length, length>, std::tuple<length, length>>
+      a{{1. * m2, 2. * m2}, {3. * m2, 4. * m2}};
+  const matrix<representation, std::tuple<double, double>,
+               std::tuple<double, double>>
+      b{{0., 1.}, {1., 0.}};
+
+  a *= b;
+
+  assert((a.at<0, 0>() == 2. * m2));
+  assert((a.at<0, 1>() == 1. * m2));
+  assert((a.at<1, 0>() == 4. * m2));
+  assert((a.at<1, 1>() == 3. * m2));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
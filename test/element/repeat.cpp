@@ -0,0 +1,84 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <tuple>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the element types, product, and transpose of matrices
+//! indexed by run-length index descriptors.
+[[maybe_unused]] const auto test{[] -> int {
+  using position = decltype(1. * m);
+  using velocity = decltype(1. * m / s);
+  using force = decltype(1. * N);
+  using state = std::tuple<repeat<position, 3>, velocity>;
+  using gain = matrix<double, state, std::tuple<repeat<force, 2>>>;
+  using compliance = matrix<double, std::tuple<repeat<decltype(1. / N), 2>>,
+                            std::tuple<repeat<decltype(1. * s), 3>>>;
+
+  static_assert(gain::rows == 4);
+  static_assert(gain::columns == 2);
+  static_assert(std::same_as<gain::element<0, 0>, decltype(1. * m * N)>);
+  static_assert(std::same_as<gain::element<2, 1>, decltype(1. * m * N)>);
+  static_assert(std::same_as<gain::element<3, 0>, decltype(1. * m / s * N)>);
+  static_assert(std::same_as<gain::element<3, 1>, decltype(1. * m / s * N)>);
+
+  gain a;
+  compliance b;
+
+  a.at<2, 0>(1. * m * N);
+  a.at<3, 0>(2. * m / s * N);
+  a.at<3, 1>(3. * m / s * N);
+  b.at<0, 2>(4. / N * s);
+  b.at<1, 2>(5. / N * s);
+
+  const auto r{a * b};
+
+  static_assert(decltype(r)::rows == 4);
+  static_assert(decltype(r)::columns == 3);
+  assert((r.at<2, 2>() == 4. * m * s));
+  assert((r.at<3, 2>() == 23. * m));
+
+  const auto aᵀ{transposed(a)};
+
+  static_assert(decltype(aᵀ)::rows == 2);
+  static_assert(decltype(aᵀ)::columns == 4);
+  assert((aᵀ.at<0, 2>() == 1. * m * N));
+  assert((aᵀ.at<1, 3>() == 3. * m / s * N));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,57 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <concepts>
+#include <tuple>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the uniformity of the elements is decided over every
+//! element, not only over the first row and column: the `double` and `int`
+//! index types do not cancel out.
+[[maybe_unused]] const auto test{[] -> int {
+  using mixed_indexes = std::tuple<double, int>;
+  using uniform_indexes = std::tuple<double, double>;
+  using mixed = matrix<double, mixed_indexes, mixed_indexes>;
+  using uniform = matrix<double, uniform_indexes, uniform_indexes>;
+
+  static_assert(std::same_as<mixed::element<0, 1>, double>);
+  static_assert(std::same_as<mixed::element<1, 0>, double>);
+  static_assert(std::same_as<mixed::element<1, 1>, int>);
+  static_assert(not uniform_typed_matrix<mixed>);
+  static_assert(uniform_typed_matrix<uniform>);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
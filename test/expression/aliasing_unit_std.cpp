@@ -0,0 +1,88 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <mdspan>
+
+namespace fcarouge::test {
+namespace {
+template <std::size_t Rows, std::size_t Columns>
+using uniform_matrix =
+    matrix<double, typed_linear_algebra_internal::tuple_n_type<double, Rows>,
+           typed_linear_algebra_internal::tuple_n_type<double, Columns>>;
+
+//! @test Verifies the lazily evaluated expressions reading their assignment
+//! destination are evaluated as with Eigen, through a temporary.
+[[maybe_unused]] const auto test{[] -> int {
+  double storage_a[]{1., 2., 3., 4.};
+  double storage_f[]{0., 1., 1., 0.};
+  double storage_x[]{1., 1., 1., 1.};
+  double storage_y[]{1., 1., 1., 1.};
+  double storage_z[]{1., 2., 3., 4.};
+
+  const uniform_matrix<2, 2> a{
+      std::mdspan{&storage_a[0], std::extents<std::size_t, 2, 2>{}}};
+  const uniform_matrix<2, 2> f{
+      std::mdspan{&storage_f[0], std::extents<std::size_t, 2, 2>{}}};
+  uniform_matrix<2, 2> x{
+      std::mdspan{&storage_x[0], std::extents<std::size_t, 2, 2>{}}};
+  uniform_matrix<2, 2> y{
+      std::mdspan{&storage_y[0], std::extents<std::size_t, 2, 2>{}}};
+  uniform_matrix<2, 2> z{
+      std::mdspan{&storage_z[0], std::extents<std::size_t, 2, 2>{}}};
+
+  x = a - x;
+
+  assert(x.at<0, 0>() == 0.);
+  assert(x.at<0, 1>() == 1.);
+  assert(x.at<1, 0>() == 2.);
+  assert(x.at<1, 1>() == 3.);
+
+  y = a + y;
+
+  assert(y.at<0, 0>() == 2.);
+  assert(y.at<0, 1>() == 3.);
+  assert(y.at<1, 0>() == 4.);
+  assert(y.at<1, 1>() == 5.);
+
+  z = f * z;
+
+  assert(z.at<0, 0>() == 3.);
+  assert(z.at<0, 1>() == 4.);
+  assert(z.at<1, 0>() == 1.);
+  assert(z.at<1, 1>() == 2.);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
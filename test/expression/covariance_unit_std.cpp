@@ -0,0 +1,76 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <mdspan>
+
+namespace fcarouge::test {
+namespace {
+template <std::size_t Rows, std::size_t Columns>
+using uniform_matrix =
+    matrix<double, typed_linear_algebra_internal::tuple_n_type<double, Rows>,
+           typed_linear_algebra_internal::tuple_n_type<double, Columns>>;
+
+//! @test Verifies the lazily evaluated expression of the covariance update is
+//! lowered to `std::linalg` on assignment.
+[[maybe_unused]] const auto test{[] -> int {
+  double storage_i[]{1., 0., 0., 1.};
+  double storage_p[]{2., 0.5, 0.5, 3.};
+  double storage_k[]{0.3, 0.7};
+  double storage_h[]{1., 2.};
+  double storage_r[]{4.};
+
+  uniform_matrix<2, 2> i{
+      std::mdspan{&storage_i[0], std::extents<std::size_t, 2, 2>{}}};
+  uniform_matrix<2, 2> p{
+      std::mdspan{&storage_p[0], std::extents<std::size_t, 2, 2>{}}};
+  uniform_matrix<2, 1> k{
+      std::mdspan{&storage_k[0], std::extents<std::size_t, 2, 1>{}}};
+  uniform_matrix<1, 2> h{
+      std::mdspan{&storage_h[0], std::extents<std::size_t, 1, 2>{}}};
+  uniform_matrix<1, 1> r{
+      std::mdspan{&storage_r[0], std::extents<std::size_t, 1, 1>{}}};
+
+  p = (i - k * h) * p * transposed(i - k * h) + k * r * transposed(k);
+
+  assert(std::abs(p.at<0, 0>() - 2.) < 1e-12);
+  assert(std::abs(p.at<0, 1>() - 0.65) < 1e-12);
+  assert(std::abs(p.at<1, 0>() - 0.65) < 1e-12);
+  assert(std::abs(p.at<1, 1>() - 3.7) < 1e-12);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
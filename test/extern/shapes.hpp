@@ -0,0 +1,57 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TEST_EXTERN_SHAPES_HPP
+#define FCAROUGE_TEST_EXTERN_SHAPES_HPP
+
+//! @file
+//! @brief Explicitly instantiated typed matrix operations of the test.
+
+#include "fcarouge/linalg.hpp"
+#include "fcarouge/typed_linear_algebra_extern.hpp"
+
+namespace fcarouge::test {
+using square = matrix<double, 3, 3>;
+using column = column_vector<double, 3>;
+} // namespace fcarouge::test
+
+FCAROUGE_TYPED_LINEAR_ALGEBRA_PRODUCT(fcarouge::test::square,
+                                      fcarouge::test::square,
+                                      fcarouge::test::square)
+FCAROUGE_TYPED_LINEAR_ALGEBRA_PRODUCT(fcarouge::test::column,
+                                      fcarouge::test::square,
+                                      fcarouge::test::column)
+FCAROUGE_TYPED_LINEAR_ALGEBRA_SUM(fcarouge::test::square,
+                                  fcarouge::test::square,
+                                  fcarouge::test::square)
+FCAROUGE_TYPED_LINEAR_ALGEBRA_FORMAT(fcarouge::test::square)
+
+#endif // FCAROUGE_TEST_EXTERN_SHAPES_HPP
@@ -47,7 +47,9 @@ namespace {
 //! shape.
 [[maybe_unused]] const auto test{[] -> int {
   using length = quantity<mp_units::isq::length[m]>;
+  using area = quantity<mp_units::isq::area[m2]>;
   using indexes = std::tuple<length, length>;
+  using result_indexes = std::tuple<area, area>;
 
   double storage_a[4]{};
   double storage_b[4]{};
@@ -59,7 +61,7 @@ namespace {
 
   matrix<representation, indexes, indexes> a{span_a};
   matrix<representation, indexes, indexes> b{span_b};
-  matrix<representation, indexes, indexes> r{span_r};
+  matrix<representation, result_indexes, result_indexes> r{span_r};
 
   a.at<0, 0>(1. * m2);
   a.at<0, 1>(2. * m2);
@@ -73,10 +75,10 @@ namespace {
 
   matrix_product(a, b, r);
 
-  assert((r.at<0, 0>() == 19. * m2));
-  assert((r.at<0, 1>() == 22. * m2));
-  assert((r.at<1, 0>() == 43. * m2));
-  assert((r.at<1, 1>() == 50. * m2));
+  assert((r.at<0, 0>() == 19. * m4));
+  assert((r.at<0, 1>() == 22. * m4));
+  assert((r.at<1, 0>() == 43. * m4));
+  assert((r.at<1, 1>() == 50. * m4));
 
   return 0;
 }()};
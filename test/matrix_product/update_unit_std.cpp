@@ -0,0 +1,74 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <mdspan>
+#include <tuple>
+
+namespace fcarouge::test {
+using representation = double;
+
+template <auto QuantityReference>
+using quantity = mp_units::quantity<QuantityReference, representation>;
+
+namespace {
+//! @test Verifies the updating matrix product algorithm accumulates into the
+//! update matrix as result.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = quantity<mp_units::isq::length[m]>;
+  using indexes = std::tuple<length, length>;
+  using scalars = std::tuple<double, double>;
+
+  double storage_a[]{1., 2., 3., 4.};
+  double storage_b[]{5., 6., 7., 8.};
+  double storage_e[]{1., 1., 1., 1.};
+
+  std::mdspan span_a{&storage_a[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_b{&storage_b[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_e{&storage_e[0], std::extents<std::size_t, 2, 2>{}};
+
+  matrix<representation, indexes, indexes> a{span_a};
+  matrix<representation, scalars, scalars> b{span_b};
+  matrix<representation, indexes, indexes> e{span_e};
+
+  matrix_product(a, b, e, e);
+
+  assert((e.at<0, 0>() == 20. * m2));
+  assert((e.at<0, 1>() == 23. * m2));
+  assert((e.at<1, 0>() == 44. * m2));
+  assert((e.at<1, 1>() == 51. * m2));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -47,6 +47,7 @@ namespace {
 //! matrix and a two element column vector.
 [[maybe_unused]] const auto test{[] -> int {
   using length = quantity<mp_units::isq::length[m]>;
+  using volume = quantity<mp_units::isq::volume[m3]>;
   using indexes = std::tuple<length, length>;
 
   double storage_a[4]{};
@@ -59,7 +60,7 @@ namespace {
 
   matrix<representation, indexes, indexes> a{span_a};
   column_vector<representation, length, length> x{span_x};
-  column_vector<representation, length, length> y{span_y};
+  column_vector<representation, volume, volume> y{span_y};
 
   a.at<0, 0>(1. * m2);
   a.at<0, 1>(2. * m2);
@@ -71,8 +72,8 @@ namespace {
 
   matrix_vector_product(a, x, y);
 
-  assert((y.at<0>() == 17. * m));
-  assert((y.at<1>() == 39. * m));
+  assert((y.at<0>() == 17. * m3));
+  assert((y.at<1>() == 39. * m3));
 
   return 0;
 }()};
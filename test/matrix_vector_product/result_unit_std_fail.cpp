@@ -0,0 +1,74 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cstddef>
+#include <mdspan>
+#include <tuple>
+
+namespace fcarouge::test {
+using representation = double;
+
+template <auto QuantityReference>
+using quantity = mp_units::quantity<QuantityReference, representation>;
+
+namespace {
+//! @test Verifies the matrix-vector product algorithm rejects a result whose
+//! element types are not those of the product: the product of square meter
+//! elements by meter elements is in cubic meter, not in meter.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = quantity<mp_units::isq::length[m]>;
+  using indexes = std::tuple<length, length>;
+
+  double storage_a[4]{};
+  double storage_x[2]{};
+  double storage_y[2]{};
+
+  std::mdspan span_a{&storage_a[0], std::extents<std::size_t, 2, 2>{}};
+  std::mdspan span_x{&storage_x[0], std::extents<std::size_t, 2, 1>{}};
+  std::mdspan span_y{&storage_y[0], std::extents<std::size_t, 2, 1>{}};
+
+  matrix<representation, indexes, indexes> a{span_a};
+  column_vector<representation, length, length> x{span_x};
+
+  // Intended:
+  // using volume = quantity<mp_units::isq::volume[m3]>;
+  // column_vector<representation, volume, volume> y{span_y};
+
+  column_vector<representation, length, length> y{span_y};
+
+  matrix_vector_product(a, x, y);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,70 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <tuple>
+
+namespace fcarouge::test {
+using representation = double;
+
+template <auto QuantityReference>
+using quantity = mp_units::quantity<QuantityReference, representation>;
+
+namespace {
+//! @test Verifies the matrix-vector product algorithm writes into a
+//! preallocated Eigen result, for row-oriented input and output vectors as for
+//! column-oriented ones.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = quantity<mp_units::isq::length[m]>;
+  using indexes = std::tuple<double, double>;
+
+  const matrix<representation, indexes, indexes> a{{1., 2.}, {3., 4.}};
+  const row_vector<representation, length, length> x{5. * m, 6. * m};
+  row_vector<representation, length, length> y;
+
+  matrix_vector_product(a, x, y);
+
+  assert((y.at<0>() == 17. * m));
+  assert((y.at<1>() == 39. * m));
+
+  const column_vector<representation, length, length> u{5. * m, 6. * m};
+  column_vector<representation, length, length> v;
+
+  matrix_vector_product(a, u, v);
+
+  assert((v.at<0>() == 17. * m));
+  assert((v.at<1>() == 39. * m));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -48,6 +48,7 @@ namespace {
 //! conventional n-by-one column orientation.
 [[maybe_unused]] const auto test{[] -> int {
   using length = quantity<mp_units::isq::length[m]>;
+  using volume = quantity<mp_units::isq::volume[m3]>;
   using indexes = std::tuple<length, length>;
 
   double storage_a[4]{};
@@ -60,7 +61,7 @@ namespace {
 
   matrix<representation, indexes, indexes> a{span_a};
   row_vector<representation, length, length> x{span_x};
-  row_vector<representation, length, length> y{span_y};
+  row_vector<representation, volume, volume> y{span_y};
 
   a.at<0, 0>(1. * m2);
   a.at<0, 1>(2. * m2);
@@ -72,8 +73,8 @@ namespace {
 
   matrix_vector_product(a, x, y);
 
-  assert((y.at<0>() == 17. * m));
-  assert((y.at<1>() == 39. * m));
+  assert((y.at<0>() == 17. * m3));
+  assert((y.at<1>() == 39. * m3));
 
   return 0;
 }()};
@@ -0,0 +1,60 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include <cassert>
+
+import fcarouge.typed_linear_algebra.eigen;
+import fcarouge.typed_linear_algebra.unit;
+
+namespace fcarouge::test {
+namespace {
+using namespace literals;
+
+//! @test Verifies the quantity element caster specializations are reachable
+//! through the named modules import, for the element accesses in both
+//! directions.
+[[maybe_unused]] const auto test{[] -> int {
+  using vector =
+      typed_column_vector<eigen::column_vector<double, 2>, position, velocity>;
+
+  vector a{1. * m, 2. * m / s};
+
+  a.at<0>(3. * m);
+  a.at<1>(4. * m / s);
+
+  assert((a.at<0>() == 3. * m));
+  assert((a[1_i] == 4. * m / s));
+  assert((a(0_i) == 3. * m));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
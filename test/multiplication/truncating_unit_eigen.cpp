@@ -0,0 +1,60 @@
+/* Typed Linear Algebra
+Version 0.3.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <tuple>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the multipliability of the terms is decided over every
+//! row-column, not only over the first one: the integral and floating-point
+//! index types do not cancel out. The first row-column terms are all `double`
+//! while the second row terms are integral and floating-point lengths, not
+//! summable without truncation.
+[[maybe_unused]] const auto test{[] -> int {
+  using length = mp_units::quantity<mp_units::isq::length[m], double>;
+  using integral_length = mp_units::quantity<mp_units::isq::length[m], int>;
+  using lhs_columns = std::tuple<int, double>;
+  using rhs_rows = std::tuple<int, int>;
+
+  using a = matrix<double, std::tuple<double, length>, lhs_columns>;
+  using truncating_a =
+      matrix<double, std::tuple<double, integral_length>, lhs_columns>;
+  using b = matrix<double, rhs_rows, std::tuple<int>>;
+
+  static_assert(multipliable<a, b>);
+  static_assert(not multipliable<truncating_a, b>);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
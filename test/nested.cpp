@@ -56,14 +56,10 @@ namespace {
               std::tuple<double, double, double>,
               std::tuple<double, double, double>>>);
 
-  static_assert(std::same_as<
-                decltype(z.data()),
-                fcarouge::typed_matrix<
-                    fcarouge::typed_matrix<Eigen::Matrix<double, 3, 3, 0, 3, 3>,
-                                           std::tuple<double, double, double>,
-                                           std::tuple<double, double, double>>,
-                    std::tuple<double, double, double>,
-                    std::tuple<double, double, double>> &>);
+  static_assert(std::same_as<decltype(z.data()),
+                             Eigen::Matrix<double, 3, 3, 0, 3, 3> &>);
+
+  static_assert(sizeof(z) == sizeof(Eigen::Matrix<double, 3, 3, 0, 3, 3>));
 
   static_assert(std::same_as<
                 decltype(z)::matrix,
@@ -76,6 +72,12 @@ namespace {
 
   static_assert(std::same_as<decltype(z)::underlying, double>);
 
+  static_assert(std::same_as<decltype((z * z + z).data()),
+                             decltype((matrix0<double, 3, 3>{} *
+                                           matrix0<double, 3, 3>{} +
+                                       matrix0<double, 3, 3>{})
+                                          .data())>);
+
   return 0;
 }()};
 } // namespace